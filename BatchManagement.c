@@ -0,0 +1,448 @@
+// needed for clock_gettime
+#define _POSIX_C_SOURCE 200112L
+
+#include "BatchManagement.h"
+#include "SchedManagement.h"
+#include <time.h>
+
+/*
+Funtion name: runBatch
+Algorithm: reads the manifest, uploads every job's config and meta data
+           serially, runs the jobs on a fixed pool of worker threads,
+           then displays one summary row per job
+Precondition: worker count is at least one
+Postcondiditon: all jobs are run and all batch memory is returned to OS
+Exceptions: returns False with an error message if the manifest could not
+            be read or holds no jobs
+Note: jobs that fail to upload are reported in the summary and not run
+*/
+Boolean runBatch( char *manifestName, int workerCount, int timerMode,
+                                                       char *errorMessage )
+{
+   // initialize variables
+   BatchJob *jobListHead = NULL;
+   BatchPool batchPool;
+   pthread_t *workerThreads = NULL;
+   int workerIndex;
+
+   // read the job list from the manifest
+      // function: getBatchManifest
+   jobListHead = getBatchManifest( manifestName, errorMessage );
+
+   // check for manifest failure
+   if( jobListHead == NULL )
+   {
+      // return failure, error message is already set
+      return False;
+   }
+
+   // upload configs and meta data before any job starts
+      // function: loadBatchJobs
+   loadBatchJobs( jobListHead );
+
+   // set up the shared job queue
+      // function: pthread_mutex_init
+   batchPool.nextJob = jobListHead;
+   batchPool.timerMode = timerMode;
+   pthread_mutex_init( &batchPool.jobMutex, NULL );
+
+   // start the worker pool
+      // function: malloc, pthread_create
+   workerThreads = (pthread_t *)malloc( sizeof( pthread_t ) * workerCount );
+
+   workerIndex = 0;
+
+   while( workerIndex < workerCount )
+   {
+      pthread_create( &workerThreads[ workerIndex ], NULL,
+                                                runBatchWorker, &batchPool );
+      workerIndex++;
+   }
+
+   // wait for every worker to run out of jobs
+      // function: pthread_join
+   workerIndex = 0;
+
+   while( workerIndex < workerCount )
+   {
+      pthread_join( workerThreads[ workerIndex ], NULL );
+      workerIndex++;
+   }
+
+   // release the pool
+      // function: free, pthread_mutex_destroy
+   free( workerThreads );
+   pthread_mutex_destroy( &batchPool.jobMutex );
+
+   // show the results in manifest order
+      // function: displayBatchSummary
+   displayBatchSummary( jobListHead );
+
+   // release all jobs
+      // function: clearBatchJobList
+   jobListHead = clearBatchJobList( jobListHead );
+
+   // return success
+   return True;
+}
+
+/*
+Funtion name: getBatchManifest
+Algorithm: reads the manifest one line at a time, each line holds a config
+           file name and an optional meta data file name that replaces the
+           one named in the config, blank lines and lines starting with #
+           are skipped
+Precondition: none
+Postcondiditon: returns the job list in manifest order
+Exceptions: returns null with an error message if the file could not be
+            opened or holds no jobs
+Note: none
+*/
+BatchJob *getBatchManifest( char *manifestName, char *errorMessage )
+{
+   // initialize variables
+   FILE *manifestFile;
+   BatchJob *jobListHead = NULL;
+   BatchJob newJob;
+   char lineBuffer[ MAX_STR_LEN ];
+   int jobCounter = 0;
+   int fieldCount;
+
+   // open the manifest
+      // function: fopen
+   manifestFile = fopen( manifestName, "r" );
+
+   // check for file open failure
+   if( manifestFile == NULL )
+   {
+      // set error message and return
+         // function: copyString
+      copyString( errorMessage, "Batch manifest access error" );
+
+      return NULL;
+   }
+
+   // loop across the manifest lines
+      // function: fgets
+   while( fgets( lineBuffer, MAX_STR_LEN, manifestFile ) != NULL )
+   {
+      // clear the optional meta data name
+      newJob.metaDataFileName[ 0 ] = NULL_CHAR;
+
+      // pull out the file names
+         // function: sscanf
+      fieldCount = sscanf( lineBuffer, "%99s %99s", newJob.configFileName,
+                                                   newJob.metaDataFileName );
+
+      // check for a job line ( not blank, not a comment )
+      if( fieldCount >= 1 && newJob.configFileName[ 0 ] != '#' )
+      {
+         // set up the job
+         jobCounter++;
+         newJob.jobNumber = jobCounter;
+         newJob.configPtr = NULL;
+         newJob.metaDataPtr = NULL;
+         newJob.ownsMetaData = False;
+         newJob.loadedFlag = False;
+         newJob.errorMessage[ 0 ] = NULL_CHAR;
+         newJob.processCount = 0;
+         newJob.segFaultCount = 0;
+         newJob.simTime = 0.0;
+         newJob.wallTime = 0.0;
+
+         // add the job to the end of the list
+            // function: addBatchJob
+         jobListHead = addBatchJob( jobListHead, &newJob );
+      }
+   }
+   // end loop
+
+   // close the manifest
+      // function: fclose
+   fclose( manifestFile );
+
+   // check for an empty manifest
+   if( jobListHead == NULL )
+   {
+      // set error message
+         // function: copyString
+      copyString( errorMessage, "Batch manifest holds no jobs" );
+   }
+
+   // return the job list
+   return jobListHead;
+}
+
+/*
+Funtion name: addBatchJob
+Algorithm: adds batch job structure with data to a linked list
+Precondition: linked list pointer assigned to null or to one job link,
+              struct pointer assigned to job struct data
+Postcondiditon: assigns new structure node to beginning of linked list
+                or and of established linked list
+Exceptions: none
+Note: assumes memory access/availability
+*/
+BatchJob *addBatchJob( BatchJob *localPtr, BatchJob *newNode )
+{
+   // check for local pointer assigned to null
+   if( localPtr == NULL )
+   {
+      // access new memory for new link/node
+         // function: malloc
+      localPtr = (BatchJob *)malloc( sizeof( BatchJob ) );
+
+      // copy the job data, assign next pointer to null
+      *localPtr = *newNode;
+      localPtr->nextNode = NULL;
+
+      // return current local pointer
+      return localPtr;
+   }
+   // assume end of list is not found yet
+   // assign recursive function to current's next link
+      // function: addBatchJob
+   localPtr->nextNode = addBatchJob( localPtr->nextNode, newNode );
+
+   // return local pointer
+   return localPtr;
+}
+
+/*
+Funtion name: loadBatchJobs
+Algorithm: uploads each job's config, then reuses the meta data list of an
+           earlier job naming the same meta data file or uploads it
+Precondition: job list built by getBatchManifest
+Postcondiditon: every job is either loaded or holds its upload error
+Exceptions: none
+Note: shared meta data lists are only read by the simulator
+*/
+void loadBatchJobs( BatchJob *jobListHead )
+{
+   // initialize variables
+   BatchJob *localPtr = jobListHead;
+   BatchJob *searchPtr;
+
+   // loop across the jobs
+   while( localPtr != NULL )
+   {
+      // upload the config, check for failure
+         // function: getConfigData
+      if( getConfigData( localPtr->configFileName, &localPtr->configPtr,
+                                         localPtr->errorMessage ) == True )
+      {
+         // check for a meta data file from the manifest
+            // function: getStringLength, copyString
+         if( getStringLength( localPtr->metaDataFileName ) > 0 )
+         {
+            // the manifest name replaces the config's
+            copyString( localPtr->configPtr->metaDataFileName,
+                                               localPtr->metaDataFileName );
+         }
+         else
+         {
+            // report the config's meta data file
+            copyString( localPtr->metaDataFileName,
+                                      localPtr->configPtr->metaDataFileName );
+         }
+
+         // look for an earlier job with the same meta data file
+         searchPtr = jobListHead;
+
+         while( searchPtr != localPtr
+                && ( searchPtr->metaDataPtr == NULL
+                     || compareString( searchPtr->metaDataFileName,
+                                  localPtr->metaDataFileName ) != STR_EQ ) )
+         {
+            searchPtr = searchPtr->nextNode;
+         }
+
+         // check for a meta data list to share
+         if( searchPtr != localPtr )
+         {
+            // reuse the earlier job's list
+            localPtr->metaDataPtr = searchPtr->metaDataPtr;
+            localPtr->loadedFlag = True;
+         }
+         // otherwise, upload the meta data
+            // function: getMetaData
+         else if( getMetaData( localPtr->metaDataFileName,
+                      &localPtr->metaDataPtr, localPtr->errorMessage ) == True )
+         {
+            // this job frees the list
+            localPtr->ownsMetaData = True;
+            localPtr->loadedFlag = True;
+         }
+         // otherwise, assume meta data upload failure
+         else
+         {
+            // make sure no other job tries to share it
+            localPtr->metaDataPtr = NULL;
+         }
+      }
+
+      // iterate to next job
+      localPtr = localPtr->nextNode;
+   }
+   // end loop
+}
+
+/*
+Funtion name: runBatchWorker
+Algorithm: takes the next job from the shared queue and runs it with its
+           own simulation context until no jobs are left
+Precondition: pointer to the batch pool
+Postcondiditon: run summary is stored in each job taken
+Exceptions: none
+Note: monitor output is suppressed, file logging still happens
+*/
+void *runBatchWorker( void *batchPoolPtr )
+{
+   // initialize variables
+   BatchPool *batchPool = (BatchPool *)batchPoolPtr;
+   BatchJob *currentJob;
+   SimContext simContext;
+   struct timespec startTime, endTime;
+
+   // loop until the queue is empty
+   do
+   {
+      // take the next job
+         // function: pthread_mutex_lock, pthread_mutex_unlock
+      pthread_mutex_lock( &batchPool->jobMutex );
+
+      currentJob = batchPool->nextJob;
+
+      if( currentJob != NULL )
+      {
+         batchPool->nextJob = currentJob->nextNode;
+      }
+
+      pthread_mutex_unlock( &batchPool->jobMutex );
+
+      // check for a job that is ready to run
+      if( currentJob != NULL && currentJob->loadedFlag == True )
+      {
+         // set up a quiet simulation for this job
+            // function: initSimContext
+         initSimContext( &simContext, currentJob->configPtr,
+                                                    batchPool->timerMode );
+         simContext.quietFlag = True;
+
+         // run and time the simulation
+            // function: clock_gettime, runSim
+         clock_gettime( CLOCK_MONOTONIC, &startTime );
+
+         runSim( &simContext, currentJob->metaDataPtr );
+
+         clock_gettime( CLOCK_MONOTONIC, &endTime );
+
+         // store the run summary
+         currentJob->processCount = simContext.processCount;
+         currentJob->segFaultCount = simContext.segFaultCount;
+         currentJob->simTime = simContext.endTime;
+         currentJob->wallTime = (double)( endTime.tv_sec - startTime.tv_sec )
+                        + (double)( endTime.tv_nsec - startTime.tv_nsec ) / 1e9;
+
+         // release the simulation state
+            // function: clearSimContext
+         clearSimContext( &simContext );
+      }
+   }
+   while( currentJob != NULL );
+
+   // return nothing
+   return NULL;
+}
+
+/*
+Funtion name: displayBatchSummary
+Algorithm: prints one row per job in manifest order
+Precondition: all jobs have been run
+Postcondiditon: summary is printed to screen
+Exceptions: none
+Note: none
+*/
+void displayBatchSummary( BatchJob *jobListHead )
+{
+   // initialize variables
+   BatchJob *localPtr = jobListHead;
+
+   // print the header
+      // function: printf
+   printf( "Batch Summary\n" );
+   printf( "-------------\n" );
+   printf( "%4s  %-20s %-20s %-7s %5s %9s %12s %12s\n", "Job", "Config",
+           "Meta Data", "Sched", "Procs", "SegFaults", "Sim Time", "Wall Time" );
+
+   // loop across the jobs
+   while( localPtr != NULL )
+   {
+      // check for a job that ran
+      if( localPtr->loadedFlag == True )
+      {
+         // print the job results
+            // function: getSchedulerName, printf
+         printf( "%4d  %-20s %-20s %-7s %5d %9d %12.6f %12.6f\n",
+                 localPtr->jobNumber, localPtr->configFileName,
+                 localPtr->metaDataFileName,
+                 getSchedulerName( localPtr->configPtr->cpuSchedCode ),
+                 localPtr->processCount, localPtr->segFaultCount,
+                 localPtr->simTime, localPtr->wallTime );
+      }
+      // otherwise, assume upload failure
+      else
+      {
+         // print the upload error
+            // function: printf
+         printf( "%4d  %-20s Upload Error: %s\n", localPtr->jobNumber,
+                           localPtr->configFileName, localPtr->errorMessage );
+      }
+
+      // iterate to next job
+      localPtr = localPtr->nextNode;
+   }
+   // end loop
+
+   printf( "\n" );
+}
+
+/*
+Funtion name: clearBatchJobList
+Algorithm: recursively iterates through batch job linked list
+           returns memory to OS from the bottom of the list upward,
+           along with each job's config and owned meta data
+Precondition: linked list, with or without data
+Postcondiditon: all node memory, if any, is returned to OS,
+                return pointer (head) is set to null
+Exceptions: none
+Note: shared meta data lists are freed only by the job that uploaded them
+*/
+BatchJob *clearBatchJobList( BatchJob *localPtr )
+{
+   // check for localPtr not set to null ( list isnt empty )
+   if( localPtr != NULL )
+   {
+      // call for recursive function with next pointer
+         // function: clearBatchJobList
+      clearBatchJobList( localPtr->nextNode );
+
+      // release the job's uploaded data
+         // function: clearConfigData, clearMetaDataList
+      localPtr->configPtr = clearConfigData( localPtr->configPtr );
+
+      if( localPtr->ownsMetaData == True )
+      {
+         localPtr->metaDataPtr = clearMetaDataList( localPtr->metaDataPtr );
+      }
+
+      // after recursive call, release memory to OS
+         // function: free
+      free( localPtr );
+
+      // set local pointer to null
+      localPtr = NULL;
+   }
+   // return null to calling function
+   return NULL;
+}
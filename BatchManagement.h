@@ -0,0 +1,64 @@
+// Pre-compiler directive
+#ifndef BATCH_MANAGEMENT_H
+#define BATCH_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include <pthread.h>
+#include "StringUtils.h"
+#include "configops.h"
+#include "metadataops.h"
+#include "simulator.h"
+
+// struct for one (config, meta data) job in a batch manifest
+typedef struct BatchJob
+{
+   // job number, in manifest order
+   int jobNumber;
+
+   // file names for the job
+   char configFileName[ 100 ];
+   char metaDataFileName[ 100 ];
+
+   // parsed input, meta data may be shared with an earlier job
+   ConfigDataType *configPtr;
+   OpCodeType *metaDataPtr;
+   Boolean ownsMetaData;
+
+   // set if both files uploaded, otherwise holds the upload error
+   Boolean loadedFlag;
+   char errorMessage[ 200 ];
+
+   // run summary
+   int processCount;
+   int segFaultCount;
+   double simTime;
+   double wallTime;
+
+   // pointer to the next job
+   struct BatchJob *nextNode;
+} BatchJob;
+
+// struct shared by the batch worker threads
+typedef struct BatchPool
+{
+   // next job to hand out, guarded by the job mutex
+   BatchJob *nextJob;
+   pthread_mutex_t jobMutex;
+
+   // real time or virtual time for every job
+   int timerMode;
+} BatchPool;
+
+// function prototypes
+Boolean runBatch( char *manifestName, int workerCount, int timerMode,
+                                                       char *errorMessage );
+BatchJob *getBatchManifest( char *manifestName, char *errorMessage );
+BatchJob *addBatchJob( BatchJob *localPtr, BatchJob *newNode );
+void loadBatchJobs( BatchJob *jobListHead );
+void *runBatchWorker( void *batchPoolPtr );
+void displayBatchSummary( BatchJob *jobListHead );
+BatchJob *clearBatchJobList( BatchJob *localPtr );
+
+#endif   // BATCH_MANAGEMENT_H
@@ -5,16 +5,13 @@
 #include "MemoryManagement.h"
 #include "CpuManagement.h"
 #include "DisplayLog.h"
-#include <pthread.h>
+#include "QueueManagement.h"
+#include "IoManagement.h"
+#include "SchedManagement.h"
+#include "DeviceManagement.h"
 #include <signal.h>
 #include <math.h>
 
-// global constants
-const int MAX_THREADS = 500;
-const int absoluteMin = 0;
-pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-static Boolean second_mutex = True;
-
 
 /*
 Funtion name: selectPCB
@@ -24,158 +21,56 @@ Postcondiditon: return the PCB selected due to above conditions
 Exceptions: none
 Note: none
 */
-PCB *selectPCB( PCB *pcbListHead, int schedFormat, int loggingFormatFlag,
-            fileOutputBuffer *localList, ConfigDataType *configPtr, 
-            PCB *previousProcess )
+PCB *selectPCB( SimContext *simContext )
 {
    // initialize variables
    PCB *nodeSelector = NULL;
-   PCB *localPtr = pcbListHead;
-   Boolean readyPCBFound = False;
-   int lowestRuntime = 2147483647;
-   int highestWaitTime = -1;
    
-   // branch to specified cpu sched code
-   switch( schedFormat )
-   {
-      case CPU_SCHED_FCFS_P_CODE:
-      case CPU_SCHED_FCFS_N_CODE:
-      
-         // loop through the pcb linked list until null or found a ready
-         while( localPtr != NULL && readyPCBFound == False )
-         {
-            // check if pcb is ready
-            if( compareString( localPtr->processState, "READY" ) == STR_EQ )
-            {
-               // set boolean to true
-               readyPCBFound = True;
-               
-               // set node selector to found PCB
-               nodeSelector = localPtr;
-            }
-            
-            // iterate to next pointer
-            localPtr = localPtr->nextNode;
-         }
-         // end loop
-         break;
-         
-      case CPU_SCHED_SRTF_P_CODE:
-      case CPU_SCHED_SJF_N_CODE:
-         
-         // loop through pcb linked list until null
-         while( localPtr != NULL )
-         {
-            // check if lowest runtime is 0 or if it is greater current PCB's ms
-            if( lowestRuntime > localPtr->msLeft  &&
-                   compareString( localPtr->processState, "READY" ) == STR_EQ )
-            {
-               // if so, reset lowest runtime
-               lowestRuntime = localPtr->msLeft;
-               
-               // set node selector to current node
-               nodeSelector = localPtr;
-            }
-            // iterate to next pointer
-            localPtr = localPtr->nextNode;
-         }
-         // end loop
-         break;
-
-      case CPU_SCHED_RR_P_CODE:
-         
-         // loop through pcb linked list until null
-         while( localPtr != NULL )
-         {
-            // check if highest wait time is less than current PCB's
-            if( highestWaitTime < localPtr->waitTime &&
-                  compareString( localPtr->processState, "READY" ) == STR_EQ )
-            {
-               // if so, reset highest wait time
-               highestWaitTime = localPtr->waitTime;
-               
-               // set node selector to current nodeSelector
-               nodeSelector = localPtr;
-            }
-            
-            // iterate to next pointer
-            localPtr = localPtr->nextNode;
-         }
-         // end loop
-         break;
-   }
+   // the ready queue is ordered by the run's scheduler
+      // function: peekReadyNode
+   nodeSelector = peekReadyNode( simContext );
    
    // check if the node selector is not null
    if( nodeSelector != NULL )
    {
    
-      if( nodeSelector->pid != previousProcess->pid )
+      if( nodeSelector->pid != simContext->previousPid )
       {
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                localList, PCB_SELECT, NONE );
+         displayAndLog( simContext, nodeSelector, PCB_SELECT, NONE );
 
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, 
-                                          localList, PCB_READY, PCB_RUNNING );
+         displayAndLog( simContext, nodeSelector, PCB_READY, PCB_RUNNING );
 
+         // a switch to another process costs the switch and the dispatch
+            // function: chargeSwitch
+         chargeSwitch( simContext, NULL );
       }
       
-      // increase wait times of all PCB's
-         // function: increaseWaitTimes
-      increaseWaitTimes( pcbListHead );
+      // stamp the selection, every other PCB has now waited one more
+      simContext->dispatchCounter++;
+      nodeSelector->dispatchStamp = simContext->dispatchCounter;
       
-      // set the selected node's wait time to zero
-      nodeSelector->waitTime = 0;
+      // set the process to running
+         // function: setPcbState
+      setPcbState( simContext, nodeSelector, PCB_RUNNING_STATE );
       
-      if( compareString(nodeSelector->processState, "BLOCKED") != STR_EQ )
-      {
-         // set the process to running
-         copyString( nodeSelector->processState, "RUNNING");
-      }
+      // tell the scheduler
+         // function: runSchedEvent
+      runSchedEvent( simContext, &simContext->readyQueue, nodeSelector,
+                                                     SCHED_EVENT_DISPATCH );
       
       // reset the previous process variable
-      previousProcess->pid = nodeSelector->pid;
+      simContext->previousPid = nodeSelector->pid;
       
+      // the cpu pays the overhead owed before the process runs
+         // function: runOverhead
+      runOverhead( simContext );
    }
    
    return nodeSelector; // return the selected PCB
 }
 
-/*
-Funtion name: increaseWaitTimes
-Algorithm: increases all wait times by 1
-Precondition: none
-Postcondiditon: none
-Exceptions: none
-Note: none
-*/
-void increaseWaitTimes( PCB *pcbListHead )
-{
-   // initialize variables
-   PCB *localPtr = pcbListHead;
-   
-   // loop until the end of the list
-   while( localPtr != NULL )
-   {
-      // check if the process state is in Exit state
-         // function: compareString
-      if( compareString( localPtr->processState, "EXIT" ) == STR_EQ )
-      {
-         localPtr->waitTime = 0;
-      }
-      // otherwise increase the wait time
-      else
-      {
-         // increase wait time
-         localPtr->waitTime++;
-      }
-      
-      // iterate to next PCB
-      localPtr = localPtr->nextNode;
-   }
-}
-
 /*
 Funtion name: cpuIdle
 Algorithm: will idle the CPU until the process with the lowest number of cycles
@@ -187,28 +82,38 @@ Postcondiditon: will return an interrupt code depending on outcome of changing
 Exceptions: none
 Note: none
 */
-cpuInterruptCodes cpuIdle( PCB *pcbListHead, int loggingFormatFlag, 
-                        fileOutputBuffer *localList, ConfigDataType *configPtr )
+cpuInterruptCodes cpuIdle( SimContext *simContext )
 {
    // initialize variables
    int minimumMSLeft;
+   PCB *nextEvent;
    
    // log event
-   displayAndLog( loggingFormatFlag, NULL, localList, CPU_IDLE, START );
+   displayAndLog( simContext, NULL, CPU_IDLE, START );
 
    // find minimum cycles left to take from each PCB
       // function getMinimumCycles
-   minimumMSLeft = getMinimumMS( pcbListHead );
+   minimumMSLeft = getMinimumMS( simContext );
+   
+   // check for an IO completion next, the idle ends when its IO worker
+   //    finishes the op
+      // function: peekEventNode, awaitIoCompletion
+   nextEvent = peekEventNode( simContext );
+   
+   if( nextEvent != NULL && nextEvent->processState == PCB_BLOCKED_STATE )
+   {
+      awaitIoCompletion( &simContext->ioPool, nextEvent );
+   }
    
    // subtract minimum cycles from each blocked pcb
       // function: updateRemainingCycles
-   updateRemainingMS( pcbListHead, minimumMSLeft );
+   updateRemainingMS( simContext, minimumMSLeft );
    
    // run timer for specified amount of cycles
-   runTimer( minimumMSLeft );
+   runTimer( &simContext->timer, minimumMSLeft );
    
    // log event
-   displayAndLog( loggingFormatFlag, NULL, localList, CPU_IDLE, FINISH );
+   displayAndLog( simContext, NULL, CPU_IDLE, FINISH );
    
    return INTERRUPT_OUT_OF_CYCLES; // stub
 }
@@ -223,41 +128,38 @@ Postcondiditon: will return an interrupt code depending on outcome of changing
 Exceptions: none
 Note: none
 */
-cpuInterruptCodes cpuRun( PCB *pcbListHead, PCB *nodeSelector, 
-                  int loggingFormatFlag, fileOutputBuffer *localList,
-                  ConfigDataType *configPtr )
+cpuInterruptCodes cpuRun( SimContext *simContext, PCB *nodeSelector )
 {
    // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
    int maxQuantumMS;
    int ioMinMS;
    int procMSLeft;
    int trueMin;
-   int pid = nodeSelector->pid;
-   pthread_t ioThread[MAX_THREADS];
    
    while( compareString( nodeSelector->currentOpCode->command, "mem" ) != STR_EQ )
       {
          if( compareString( nodeSelector->currentOpCode->command, "cpu" ) == STR_EQ )
          {
-            maxQuantumMS = configPtr->quantumCycles * configPtr->procCycleRate;
-            ioMinMS = getMinimumMS( pcbListHead );
+            maxQuantumMS = getQuantumMS( simContext, nodeSelector );
+            ioMinMS = getMinimumMS( simContext );
             procMSLeft = nodeSelector->opMSLeft;
             trueMin = findMin( ioMinMS, maxQuantumMS, procMSLeft );
             
             // log event
-            displayAndLog( loggingFormatFlag, nodeSelector, localList, CPU, START );
+            displayAndLog( simContext, nodeSelector, CPU, START );
             
             // update the remaining ms
-            updateRemainingMS( pcbListHead, trueMin );
+            updateRemainingMS( simContext, trueMin );
             
             // run timer for designated minimum MS
-            runTimer( trueMin );
+            runTimer( &simContext->timer, trueMin );
             
             // check if minimum is a blocked process
             if( trueMin == ioMinMS )
             {
                // update finished IO
-               updateIO( pcbListHead, loggingFormatFlag, localList, configPtr );
+               updateIO( simContext );
             }
             // check if minimum is the quantum timer
             else if( trueMin == maxQuantumMS )
@@ -269,18 +171,25 @@ cpuInterruptCodes cpuRun( PCB *pcbListHead, PCB *nodeSelector,
             else
             {
                // log event
-               displayAndLog( loggingFormatFlag, nodeSelector, localList, CPU, FINISH );
+               displayAndLog( simContext, nodeSelector, CPU, FINISH );
                
                updatePcbOpCode( nodeSelector, configPtr );
+               
+               // the process is ready again, though it keeps running its ops
+                  // function: setPcbState
+               setPcbState( simContext, nodeSelector, PCB_READY_STATE );
             }
          }
          // assume the op code is dev
          else
          {
             // log event
-            displayAndLog( loggingFormatFlag, nodeSelector, localList, DEV, START );
+            displayAndLog( simContext, nodeSelector, DEV, START );
             
-            pthread_create(&ioThread[pid], NULL, runPThread, NULL);
+            // hand the op to an IO worker ( real time only )
+               // function: submitIoRequest
+            submitIoRequest( &simContext->ioPool, &simContext->timer,
+                                                             nodeSelector );
             
             return INTERRUPT_FROM_IO_BLOCK;
          }
@@ -300,9 +209,8 @@ Postcondiditon: return PCB
 Exceptions: none
 Note: none
 */
-void interruptHandler( PCB *pcbListHead, cpuInterruptCodes currentInterrupt, 
-                       int loggingFormatFlag, fileOutputBuffer *localList,
-                       ConfigDataType *configPtr, PCB *nodeSelector )
+void interruptHandler( SimContext *simContext, 
+                    cpuInterruptCodes currentInterrupt, PCB *nodeSelector )
 {
    // start switch case for each interrupt code 
    switch( currentInterrupt )
@@ -310,29 +218,45 @@ void interruptHandler( PCB *pcbListHead, cpuInterruptCodes currentInterrupt,
       case INTERRUPT_FROM_QUANTUM:
 
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, localList, QUANT_INT, NONE );
+         displayAndLog( simContext, nodeSelector, QUANT_INT, NONE );
+
+         // function: chargeInterrupt
+         chargeInterrupt( simContext, NULL );
+
+         // tell the scheduler the quantum was used up
+            // function: runSchedEvent
+         runSchedEvent( simContext, &simContext->readyQueue, nodeSelector,
+                                                         SCHED_EVENT_TICK );
 
          // set the PCB's state to READY
-         copyString( nodeSelector->processState, "READY" );
+            // function: setPcbState
+         setPcbState( simContext, nodeSelector, PCB_READY_STATE );
          
          // update all io processes that have reached 0 ms
             // function: updateIO
-         updateIO( pcbListHead, loggingFormatFlag, localList, configPtr );
+         updateIO( simContext );
 
          break;
 
       case INTERRUPT_FROM_IO_BLOCK:
 
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, localList, BLOCKED_INT, NONE );
+         displayAndLog( simContext, nodeSelector, BLOCKED_INT, NONE );
          
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, 
-                                          localList, PCB_RUNNING, PCB_BLOCKED );
+         displayAndLog( simContext, nodeSelector, PCB_RUNNING, PCB_BLOCKED );
+
+         // function: chargeInterrupt
+         chargeInterrupt( simContext, NULL );
+
+         // tell the scheduler the process gave up the cpu for IO
+            // function: runSchedEvent
+         runSchedEvent( simContext, &simContext->readyQueue, nodeSelector,
+                                                        SCHED_EVENT_BLOCK );
 
          // change the pcb state from running to blocked
-            // function: copyString
-         copyString( nodeSelector->processState, "BLOCKED" );
+            // function: setPcbState
+         setPcbState( simContext, nodeSelector, PCB_BLOCKED_STATE );
 
          break;
 
@@ -340,32 +264,42 @@ void interruptHandler( PCB *pcbListHead, cpuInterruptCodes currentInterrupt,
 
          // update all io processes that have reached 0 ms
             // function: updateIO
-         updateIO( pcbListHead, loggingFormatFlag, localList, configPtr );
+         updateIO( simContext );
 
          break;
 
       case INTERRUPT_SEG_FAULT:
 
+         // count the seg fault
+         simContext->segFaultCount++;
+
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, localList, MEM_FAIL, NONE );
+         displayAndLog( simContext, nodeSelector, MEM_FAIL, NONE );
+
+         // function: chargeInterrupt
+         chargeInterrupt( simContext, NULL );
 
          // change the pcb state from running to exit
-            // function: copyString
-         copyString( nodeSelector->processState, "EXIT" );
+            // function: setPcbState
+         setPcbState( simContext, nodeSelector, PCB_EXIT_STATE );
          
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, localList, PCB_EXIT, NONE );
+         displayAndLog( simContext, nodeSelector, PCB_EXIT, NONE );
 
          break;
 
       case SUCCESSFUL_MEM_OP:
       
          // log event
-         displayAndLog( loggingFormatFlag, nodeSelector, localList, MEM_SUCCESS, NONE );
+         displayAndLog( simContext, nodeSelector, MEM_SUCCESS, NONE );
 
          // set the next op code for pcb
             // function: updatePcbOpCode
-         updatePcbOpCode( nodeSelector, configPtr );
+         updatePcbOpCode( nodeSelector, simContext->configPtr );
+         
+         // set the pcb back to ready
+            // function: setPcbState
+         setPcbState( simContext, nodeSelector, PCB_READY_STATE );
          
          break;
 
@@ -373,74 +307,80 @@ void interruptHandler( PCB *pcbListHead, cpuInterruptCodes currentInterrupt,
          break;
    }
    
+   // check if the interrupted pcb has reached app end
+   if( nodeSelector != NULL )
+   {
+      // function: queueFinishedPcb
+      queueFinishedPcb( simContext, nodeSelector );
+   }
+   
    // check to see if any pcb's have finished all of their ops
       // function: checkListForFinish
-   checkListForFinishAndReady( pcbListHead, loggingFormatFlag, localList );
+   checkListForFinishAndReady( simContext );
+   
+   // check if the MLFQ priority boost is due
+      // function: checkPriorityBoost
+   checkPriorityBoost( simContext );
 }
 
 /*
 Funtion name: getMinimumCycles
-Algorithm: go through the pcb list and return the lowest amount of cycles left 
-           that were found
+Algorithm: return the ms left until the earliest IO completion, read from
+           the event queue
 Precondition: none of the pcb's have 0 cycles left
 Postcondiditon: will return an integer for the number of cycles found
 Exceptions: none
-Note: none
+Note: returns the largest int if no process is blocked
 */
-int getMinimumMS( PCB *pcbListHead )
+int getMinimumMS( SimContext *simContext )
 {
    // initialize vaiables
    int MAX_MS = 2147483647;
-   PCB *localPtr = pcbListHead;
+   PCB *nextEvent;
    int minimumMS = MAX_MS;
    
-   // loop through PCB list
-   while( localPtr != NULL )
+   // find the earliest IO completion
+      // function: peekEventNode
+   nextEvent = peekEventNode( simContext );
+   
+   // check for a blocked process
+   if( nextEvent != NULL )
    {
-      //printf( "GET_MINIMUM_MS: PCB %d State: %s OP MS Left: %d \n", localPtr->pid, localPtr->processState, localPtr->opMSLeft );
-      // check if cycles left if greater than local pointer'switch
-      if( ( minimumMS > localPtr->opMSLeft ) &&
-             compareString( localPtr->processState, "BLOCKED" ) == STR_EQ )
-      {
-         // set new minimum
-         minimumMS = localPtr->opMSLeft;
-      }
-      // iterate forward
-      localPtr = localPtr->nextNode;
+      // set new minimum
+      minimumMS = nextEvent->ioDeadline - simContext->simMSec;
    }
    
-   return minimumMS; // stub
+   return minimumMS;
 }
 
 /*
 Funtion name: updateRemainingCycles
-Algorithm: go through the pcb list and subtract designated cycles
+Algorithm: advance the simulated clock and subtract designated cycles from
+           the running process
 Precondition: none of the pcb's have 0 cycles left
 Postcondiditon: none
 Exceptions: none
-Note: none
+Note: blocked processes are charged when their IO completes
 */
-void updateRemainingMS( PCB *pcbListHead, int msToSubtract )
+void updateRemainingMS( SimContext *simContext, int msToSubtract )
 {
    // initialize vaiables
-   PCB *localPtr = pcbListHead;
+   PCB *localPtr = simContext->runningPCB;
    
-   // loop through PCB list
-   while( localPtr != NULL )
+   // advance the clock, moving every blocked process closer to its deadline
+   simContext->simMSec = simContext->simMSec + msToSubtract;
+   
+   // check for a running process
+   if( localPtr != NULL )
    {
-      // check if process is either running or blocked
-      if( compareString( localPtr->processState, "BLOCKED" ) == STR_EQ ||
-            compareString( localPtr->processState, "RUNNING" ) == STR_EQ )
-      {
-         // subtract all number from cycles left
-         localPtr->msLeft = localPtr->msLeft - msToSubtract;
-         
-         // subtract all number from cycles left
-         localPtr->opMSLeft = localPtr->opMSLeft - msToSubtract;
-      }
+      // subtract all number from cycles left
+      localPtr->msLeft = localPtr->msLeft - msToSubtract;
       
-      // iterate forward
-      localPtr = localPtr->nextNode;
+      // subtract all number from cycles left
+      localPtr->opMSLeft = localPtr->opMSLeft - msToSubtract;
+      
+      // charge the virtual runtime
+      localPtr->vruntime = localPtr->vruntime + msToSubtract;
    }
 }
 
@@ -454,37 +394,46 @@ Note: none
 */
 int findMin( int first, int second, int third )
 {
-   // initialize counter
-   int counter = 0;
+   // initialize minimum to the first value
+   int minimum = first;
    
-   //loop until one of the numbers gets to zero
-   while( first && second && third )
+   // check if second is lower
+   if( second < minimum )
    {
-      first--;
-      second--;
-      third--;
-      counter++;
+      minimum = second;
    }
-   // return counter
-   return counter;
+   
+   // check if third is lower
+   if( third < minimum )
+   {
+      minimum = third;
+   }
+   
+   // return minimum, never below zero
+   if( minimum < 0 )
+   {
+      minimum = 0;
+   }
+   
+   return minimum;
 }
 
 /*
 Funtion name: updatePcbOpCode
 Algorithm: reset the wait time and op code of selected pcb
 Precondition: the wait time in ms is at 0 already
-Postcondiditon: the pcb is back to being able to start again (ready state)
+Postcondiditon: the pcb is set up to run its next op code
 Exceptions: none
-Note: none
+Note: the caller sets the process state
 */
 void updatePcbOpCode( PCB *nodeSelector, ConfigDataType *configPtr )
 {
    // initialize variables
    int procCycleRate = configPtr->procCycleRate;
-   int ioCycleRate = configPtr->ioCycleRate;
 
-   // set the next op code for pcb
+   // set the next op code for pcb, any swap in of the last op is done
    nodeSelector->currentOpCode = nodeSelector->currentOpCode->nextNode;
+   nodeSelector->swapPageCount = 0;
    
    // check for if op code in not mem
    if( compareString( nodeSelector->currentOpCode->command, "mem" ) == STR_EQ )
@@ -502,49 +451,46 @@ void updatePcbOpCode( PCB *nodeSelector, ConfigDataType *configPtr )
    // check for if op code in not mem
    else
    {
-      // set the new wait time for current op code
-      nodeSelector->opMSLeft = nodeSelector->currentOpCode->intArg2*
-                                                            ioCycleRate;
+      // set the new wait time for current op code from its device
+         // function: getDeviceOpMS
+      nodeSelector->opMSLeft = getDeviceOpMS( configPtr,
+                                              nodeSelector->currentOpCode );
    }
-   
-   // set process state to ready
-   copyString( nodeSelector->processState, "READY" );
 }
 
 /*
 Funtion name: checkListForFinish
-Algorithm: checks for if any current op codes are at app end, and will update 
-           the wait time of any processes that have remained in READY
-Precondition: none
+Algorithm: sets every process queued at app end to exit, in pid order
+Precondition: processes reaching app end were queued by queueFinishedPcb
 Postcondiditon: changes pcb to exit state and reports change
 Exceptions: none
 Note: none
 */
-void checkListForFinishAndReady( PCB *pcbListHead, int loggingFormatFlag,
-                                                   fileOutputBuffer *localList )
+void checkListForFinishAndReady( SimContext *simContext )
 {
    // initialize variables
    PCB *localPtr;
    
-   // set local to list head
-   localPtr = pcbListHead;
+   // take the first finished PCB
+      // function: takeFinishedPcb
+   localPtr = takeFinishedPcb( simContext );
    
-   // loop until at end of list
+   // loop until no finished PCB is left
    while( localPtr != NULL )
    {
-      if( compareString( localPtr->currentOpCode->command, "app" ) == STR_EQ &&
-         compareString( localPtr->currentOpCode->strArg1, "end" ) == STR_EQ &&
-         compareString( localPtr->processState, "EXIT" ) != STR_EQ )
+      // check the pcb did not exit while it waited
+      if( localPtr->processState != PCB_EXIT_STATE )
          {
             // log event
-            displayAndLog( loggingFormatFlag, localPtr, localList, PCB_EXIT, NONE );
+            displayAndLog( simContext, localPtr, PCB_EXIT, NONE );
 
             // set pcb state to exit
-            copyString( localPtr->processState, "EXIT" );
+               // function: setPcbState
+            setPcbState( simContext, localPtr, PCB_EXIT_STATE );
          }
 
-      // iterate to next PCB
-      localPtr = localPtr->nextNode;
+      // take the next finished PCB
+      localPtr = takeFinishedPcb( simContext );
 
    // end loop
    }
@@ -552,76 +498,451 @@ void checkListForFinishAndReady( PCB *pcbListHead, int loggingFormatFlag,
 
 /*
 Funtion name: updateIO
-Algorithm: updates all blocked processes that have finished their dev code
+Algorithm: updates all blocked processes that have finished their dev code,
+           and admits the processes that have arrived, taking them off the
+           event queue in deadline then pid order
 Precondition: none
 Postcondiditon: changes pcb to exit state and reports change
 Exceptions: none
 Note: none
 */
-void updateIO( PCB *pcbListHead, int loggingFormatFlag,
-                        fileOutputBuffer *localList, ConfigDataType *configPtr )
+void updateIO( SimContext *simContext )
 {
    // initialize variables
    PCB *localPtr;
    
-   // set local to list head
-   localPtr = pcbListHead;
+   // check if a process is running
+   if( simContext->runningPCB != NULL )
+   {
+      // change the state back to ready
+         // function: setPcbState
+      setPcbState( simContext, simContext->runningPCB, PCB_READY_STATE );
+   }
    
-   // loop until at end of list
+   // take the earliest due IO completion
+      // function: takeDueEventNode
+   localPtr = takeDueEventNode( simContext );
+   
+   // loop until no IO completion is due
    while( localPtr != NULL )
    {
-      // check if the process state is running
-      if( compareString( localPtr->processState, "RUNNING" ) == STR_EQ )
+      // check for a process arriving rather than back from IO
+      if( localPtr->processState == PCB_NEW_STATE )
       {
-         // change the state back to ready
-            // function: copyString
-         copyString( localPtr->processState, "READY" );
+         // function: admitPcb
+         admitPcb( simContext, localPtr );
       }
-      // check if the process is blocked and their ms left is zero
-      if( compareString( localPtr->processState, "BLOCKED" ) == STR_EQ &&
-            localPtr->opMSLeft == 0 )
-         {
-            // unlock mutex
-            second_mutex = False;
-            pthread_mutex_unlock(&mutex);
-            
-            // log event
-            displayAndLog( loggingFormatFlag, localPtr, localList, FINISH_INT, NONE );
-   
-            // log event
-            displayAndLog( loggingFormatFlag, localPtr, localList, PCB_BLOCKED, NONE );
-            
-            // update the specific PCB
-            updatePcbOpCode( localPtr, configPtr );
-         }
+      // otherwise, assume an IO completion
+      else
+      {
+         // the process wakes once its IO worker has finished the op
+            // function: awaitIoCompletion
+         awaitIoCompletion( &simContext->ioPool, localPtr );
+         
+         // charge the process for the time it was blocked
+         localPtr->msLeft = localPtr->msLeft - localPtr->opMSLeft;
+         localPtr->opMSLeft = 0;
+      
+         // log event
+         displayAndLog( simContext, localPtr, FINISH_INT, NONE );
 
-      // iterate to next PCB
-      localPtr = localPtr->nextNode;
+         // log event
+         displayAndLog( simContext, localPtr, PCB_BLOCKED, NONE );
+      
+         // function: chargeInterrupt
+         chargeInterrupt( simContext, NULL );
+      
+         // update the specific PCB
+         updatePcbOpCode( localPtr, simContext->configPtr );
+      
+         // tell the scheduler it is back from IO
+            // function: runSchedEvent
+         runSchedEvent( simContext, &simContext->readyQueue, localPtr,
+                                                            SCHED_EVENT_WAKE );
+      
+         // set it back to ready
+            // function: setPcbState
+         setPcbState( simContext, localPtr, PCB_READY_STATE );
+      
+         // check if it has reached app end
+            // function: queueFinishedPcb
+         queueFinishedPcb( simContext, localPtr );
+      }
+
+      // iterate to next IO completion
+         // function: takeDueEventNode
+      localPtr = takeDueEventNode( simContext );
 
    // end loop
    }
 }
 
 /*
-Funtion name: runPThread
-Algorithm: Runs the timer for the number of cycles specified
-           for the IO op code
-Precondition: Given op code pointer cycles
+Funtion name: admitArrivals
+Algorithm: admits every process whose arrival time has been reached, one
+           arrival time at a time, in arrival then pid order
+Precondition: the event queue holds only processes waiting to arrive
+Postcondiditon: the arrived processes are READY
+Exceptions: none
+Note: used by the loop that runs each process to its end, whose clock
+      jumps a whole op at a time; the clock steps back to each arrival
+      time so the heap and the wheel hand out the same batches
+*/
+void admitArrivals( SimContext *simContext )
+{
+   // initialize variables
+   int runMSec = simContext->simMSec;
+   PCB *localPtr;
+
+   // find the earliest arrival
+      // function: peekEventNode
+   localPtr = peekEventNode( simContext );
+
+   // loop across the arrival times reached
+   while( localPtr != NULL && localPtr->ioDeadline <= runMSec )
+   {
+      // take the processes arriving at this time
+         // function: takeDueEventNode
+      simContext->simMSec = localPtr->ioDeadline;
+      localPtr = takeDueEventNode( simContext );
+
+      while( localPtr != NULL )
+      {
+         // function: admitPcb
+         admitPcb( simContext, localPtr );
+
+         // function: takeDueEventNode
+         localPtr = takeDueEventNode( simContext );
+      }
+
+      // function: peekEventNode
+      localPtr = peekEventNode( simContext );
+   }
+
+   // set the clock back to the run time
+   simContext->simMSec = runMSec;
+}
+
+/*
+Funtion name: admitArrivalsBefore
+Algorithm: runs the clock and the timer up to each arrival time before the
+           end time and admits the processes arriving there
+Precondition: the event queue holds only processes waiting to arrive
+Postcondiditon: the clock is at the last arrival time before the end time,
+                or unchanged if none comes first
+Exceptions: none
+Note: used by the loop that runs each process to its end, so a process
+      arriving during an op is admitted at its own arrival time; the
+      caller runs the rest of the way to the end time
+*/
+void admitArrivalsBefore( SimContext *simContext, int endMSec )
+{
+   // initialize variables
+   PCB *localPtr;
+
+   // find the earliest arrival
+      // function: peekEventNode
+   localPtr = peekEventNode( simContext );
+
+   // loop across the arrival times before the end time
+   while( localPtr != NULL && localPtr->ioDeadline < endMSec )
+   {
+      // run up to the arrival time
+      if( localPtr->ioDeadline > simContext->simMSec )
+      {
+         // function: runTimer
+         runTimer( &simContext->timer,
+                              localPtr->ioDeadline - simContext->simMSec );
+         simContext->simMSec = localPtr->ioDeadline;
+      }
+
+      // function: admitArrivals
+      admitArrivals( simContext );
+
+      // function: peekEventNode
+      localPtr = peekEventNode( simContext );
+   }
+}
+
+/*
+Funtion name: admitPcb
+Algorithm: moves a process that has arrived from NEW to READY and sets up
+           its first op
+Precondition: PCB is NEW and taken off the event queue
+Postcondiditon: PCB is READY, or queued to exit if its program is empty
+Exceptions: none
+Note: it has waited least, so it is stamped with the latest selection
+*/
+void admitPcb( SimContext *simContext, PCB *pcb )
+{
+   // log event
+   displayAndLog( simContext, pcb, PCB_NEW, PCB_READY );
+
+   // set up PCB for running
+      // function: updatePcbOpCode
+   pcb->opMSLeft = 0;
+   updatePcbOpCode( pcb, simContext->configPtr );
+   pcb->dispatchStamp = simContext->dispatchCounter;
+
+   // let the scheduler place it as it would a woken process
+      // function: runSchedEvent
+   runSchedEvent( simContext, &simContext->readyQueue, pcb,
+                                                         SCHED_EVENT_WAKE );
+
+   // function: setPcbState
+   setPcbState( simContext, pcb, PCB_READY_STATE );
+
+   // check for an empty program
+      // function: queueFinishedPcb
+   queueFinishedPcb( simContext, pcb );
+}
+
+/*
+Funtion name: getQuantumMS
+Algorithm: returns the slice the run's scheduler gives the process, from
+           the ready processes of its core or the context and itself
+Precondition: the PCB is valid
 Postcondiditon: none
 Exceptions: none
 Note: none
 */
-void *runPThread()
+int getQuantumMS( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   int runnableCount;
+   
+   // count the ready processes of the core or the context, and this one
+   if( simContext->coreArray != NULL )
+   {
+      runnableCount = simContext->coreArray[ pcb->coreId ].readyCount + 1;
+   }
+   else
+   {
+      runnableCount = simContext->readyCount + 1;
+   }
+   
+   // function: getSliceMS
+   return simContext->schedOps->getSliceMS( simContext->configPtr, pcb,
+                                                            runnableCount );
+}
+
+/*
+Funtion name: checkPriorityBoost
+Algorithm: once the boost time has passed, boosts every process that has
+           not exited and sets the next boost
+Precondition: none
+Postcondiditon: the next boost time is after the current time
+Exceptions: none
+Note: the boost keeps long running processes from starving
+*/
+void checkPriorityBoost( SimContext *simContext )
 {
-   while(second_mutex == True);
-   second_mutex = True;
-   pthread_mutex_lock(&mutex);
+   // initialize variables
+   int boostMS = simContext->configPtr->mlfqBoostMS;
+   PCB *localPtr = simContext->pcbListHead;
    
-   // pause the program for the specified cycles
-            // function: runTimer
-   runTimer( absoluteMin );
+   // check if a boost is set and due
+   if( simContext->nextBoostMSec < 0
+                         || simContext->simMSec < simContext->nextBoostMSec )
+   {
+      return;
+   }
    
-   //printf("Thread complete\n");
+   // log event
+   displayAndLog( simContext, NULL, MLFQ_BOOST, NONE );
+   
+   // loop across every process
+   while( localPtr != NULL )
+   {
+      // check for a process that has not exited
+      if( localPtr->exitReached == False )
+      {
+         // function: runSchedEvent
+         runSchedEvent( simContext, &simContext->readyQueue, localPtr,
+                                                        SCHED_EVENT_BOOST );
+      }
+      
+      localPtr = localPtr->nextNode;
+   }
    
-   return NULL;
+   // set the next boost after the current time
+   simContext->nextBoostMSec =
+                        ( simContext->simMSec / boostMS + 1 ) * boostMS;
+}
+
+/*
+Funtion name: chargeSwitch
+Algorithm: adds the context switch and dispatch latency to the overhead
+           owed by the cpu, or by the core if one is given
+Precondition: a process other than the last one was selected
+Postcondiditon: the overhead is paid at the dispatch
+Exceptions: none
+Note: none
+*/
+void chargeSwitch( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int switchMS = configPtr->contextSwitchMS + configPtr->dispatchLatencyMS;
+
+   // check for a core of a multi-core run
+   if( core != NULL )
+   {
+      core->pendingOverheadMS = core->pendingOverheadMS + switchMS;
+      core->switchCount++;
+   }
+   // otherwise, assume the one cpu
+   else
+   {
+      simContext->pendingOverheadMS = simContext->pendingOverheadMS
+                                                                + switchMS;
+      simContext->switchCount++;
+   }
+}
+
+/*
+Funtion name: chargeInterrupt
+Algorithm: adds the interrupt handler cost to the overhead owed by the
+           cpu, or by the core if one is given
+Precondition: an interrupt was handled
+Postcondiditon: the overhead is paid at the next dispatch
+Exceptions: none
+Note: none
+*/
+void chargeInterrupt( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   int interruptMS = simContext->configPtr->interruptCostMS;
+
+   // check for a core of a multi-core run
+   if( core != NULL )
+   {
+      core->pendingOverheadMS = core->pendingOverheadMS + interruptMS;
+      core->interruptCount++;
+   }
+   // otherwise, assume the one cpu
+   else
+   {
+      simContext->pendingOverheadMS = simContext->pendingOverheadMS
+                                                             + interruptMS;
+      simContext->interruptCount++;
+   }
+}
+
+/*
+Funtion name: runOverhead
+Algorithm: advances the clock by the overhead owed without charging the
+           selected process; for the preemptive codes the clock stops at
+           each IO completion or arrival on the way, and the interrupts
+           handled there add to the overhead
+Precondition: a process was selected to run
+Postcondiditon: no overhead is owed
+Exceptions: none
+Note: no IO deadline is passed, so the cpu never sees an IO completion
+      in its past; the run to completion loop admits the arrivals after
+      the clock steps back to each one
+*/
+void runOverhead( SimContext *simContext )
+{
+   // initialize variables
+   Boolean preemptive = simContext->schedOps->preemptiveFlag;
+   int stepMS;
+   int ioMinMS;
+
+   // loop until the overhead owed is paid
+   while( simContext->pendingOverheadMS > 0 )
+   {
+      // run up to the next IO completion or arrival, if it comes first
+         // function: getMinimumMS
+      stepMS = simContext->pendingOverheadMS;
+      ioMinMS = getMinimumMS( simContext );
+
+      if( ioMinMS < stepMS )
+      {
+         stepMS = ioMinMS;
+      }
+
+      // the time belongs to the OS, no process is charged
+      simContext->simMSec = simContext->simMSec + stepMS;
+      simContext->pendingOverheadMS = simContext->pendingOverheadMS - stepMS;
+      simContext->overheadMS = simContext->overheadMS + stepMS;
+
+      // function: runTimer
+      runTimer( &simContext->timer, stepMS );
+
+      // check for the run to completion loop
+      if( preemptive == False )
+      {
+         // function: admitArrivals
+         admitArrivals( simContext );
+      }
+      // otherwise, check for a due IO completion or arrival
+      else if( stepMS == ioMinMS )
+      {
+         // function: updateIO
+         updateIO( simContext );
+      }
+   }
+}
+
+/*
+Funtion name: reportOverhead
+Algorithm: sums the overhead of the cores, sets its share of the cpu time
+           of the run and logs it
+Precondition: every process is in EXIT
+Postcondiditon: overhead summary is set and logged
+Exceptions: a run with no overhead cost configured is not logged
+Note: overhead still owed when the last process exits was never paid,
+      so it is left out
+*/
+void reportOverhead( SimContext *simContext )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int coreIndex = 0;
+   int cpuCount = 1;
+   long long cpuMS;
+   SimCore *core;
+
+   // check for no overhead cost
+   if( configPtr->contextSwitchMS == 0 && configPtr->dispatchLatencyMS == 0
+                                     && configPtr->interruptCostMS == 0 )
+   {
+      return;
+   }
+
+   // check for a multi-core run
+   if( simContext->coreArray != NULL )
+   {
+      cpuCount = simContext->coreCount;
+
+      // loop across the cores
+      while( coreIndex < simContext->coreCount )
+      {
+         core = &simContext->coreArray[ coreIndex ];
+
+         simContext->overheadMS = simContext->overheadMS + core->overheadMS;
+         simContext->switchCount = simContext->switchCount
+                                                      + core->switchCount;
+         simContext->interruptCount = simContext->interruptCount
+                                                   + core->interruptCount;
+
+         coreIndex++;
+      }
+   }
+
+   // a run of zero length counts as one ms
+   cpuMS = (long long)simContext->simMSec * cpuCount;
+
+   if( cpuMS <= 0 )
+   {
+      cpuMS = 1;
+   }
+
+   simContext->overheadPercent = (double)simContext->overheadMS * 100
+                                                                    / cpuMS;
+
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, OVERHEAD_REPORT, NONE );
 }
@@ -11,26 +11,25 @@ typedef enum { INTERRUPT_FROM_QUANTUM,
                NO_INTERRUPT } cpuInterruptCodes;
                
 // function prototypes
-PCB *selectPCB( PCB *pcbListHead, int schedFormat, int loggingFormatFlag,
-            fileOutputBuffer *localList, ConfigDataType *configPtr, 
-            PCB *previousProcess );
-cpuInterruptCodes cpuIdle( PCB *pcbListHead, int loggingFormatFlag, 
-                        fileOutputBuffer *localList, ConfigDataType *configPtr );
-cpuInterruptCodes cpuRun( PCB *pcbListHead, PCB *nodeSelector, 
-                  int loggingFormatFlag, fileOutputBuffer *localList,
-                  ConfigDataType *configPtr );
-void interruptHandler( PCB *pcbListHead, cpuInterruptCodes currentInterrupt, 
-                       int loggingFormatFlag, fileOutputBuffer *localList,
-                       ConfigDataType *configPtr, PCB *nodeSelector );
-int getMinimumMS( PCB *pcbListHead );
-void updateRemainingMS( PCB *pcbListHead, int msToSubtract );
+PCB *selectPCB( SimContext *simContext );
+cpuInterruptCodes cpuIdle( SimContext *simContext );
+cpuInterruptCodes cpuRun( SimContext *simContext, PCB *nodeSelector );
+void interruptHandler( SimContext *simContext, 
+                    cpuInterruptCodes currentInterrupt, PCB *nodeSelector );
+int getMinimumMS( SimContext *simContext );
+void updateRemainingMS( SimContext *simContext, int msToSubtract );
 int findMin( int first, int second, int third );
 void updatePcbOpCode( PCB *nodeSelector, ConfigDataType *configPtr );
-void checkListForFinishAndReady( PCB *pcbListHead, int loggingFormatFlag,
-                                                   fileOutputBuffer *localList );
-void updateIO( PCB *pcbListHead, int loggingFormatFlag,
-                        fileOutputBuffer *localList, ConfigDataType *configPtr );
-void increaseWaitTimes( PCB *pcbListHead );
-void *runPThread();
+void checkListForFinishAndReady( SimContext *simContext );
+void updateIO( SimContext *simContext );
+void admitArrivals( SimContext *simContext );
+void admitArrivalsBefore( SimContext *simContext, int endMSec );
+void admitPcb( SimContext *simContext, PCB *pcb );
+int getQuantumMS( SimContext *simContext, PCB *pcb );
+void checkPriorityBoost( SimContext *simContext );
+void chargeSwitch( SimContext *simContext, SimCore *core );
+void chargeInterrupt( SimContext *simContext, SimCore *core );
+void runOverhead( SimContext *simContext );
+void reportOverhead( SimContext *simContext );
 
 #endif   // CPUMANAGEMENT_H
@@ -0,0 +1,565 @@
+#include "DeviceManagement.h"
+#include "QueueManagement.h"
+
+// global constants
+// device names as they appear in a dev op, in device code order
+char *DEVICE_NAMES[] = { "ethernet", "hard drive", "keyboard", "monitor",
+                         "printer", "serial", "sound signal", "swap", "usb",
+                         "video signal" };
+
+/*
+Funtion name: initDevices
+Algorithm: sets every device to idle with the channels of its device
+           table entry, its wait list empty and its disk head at track
+           zero moving up
+Precondition: context config data is set
+Postcondiditon: device servers are ready, run summaries are zero
+Exceptions: none
+Note: zero channels leaves a device unlimited
+*/
+void initDevices( SimContext *simContext )
+{
+   // initialize variables
+   int deviceIndex = 0;
+   SimDevice *device;
+
+   // loop across the devices
+   while( deviceIndex < DEVICE_COUNT )
+   {
+      device = &simContext->deviceArray[ deviceIndex ];
+
+      device->channelCount =
+          simContext->configPtr->deviceTable[ deviceIndex ].channelCount;
+      device->busyChannels = 0;
+
+      device->waitHead = NULL;
+      device->waitTail = NULL;
+      device->waitCount = 0;
+
+      device->headTrack = 0;
+      device->headUpFlag = True;
+
+      device->requestCount = 0;
+      device->busyMS = 0;
+      device->waitSumMS = 0;
+      device->waitMaxMS = 0;
+      device->depthSumMS = 0;
+      device->depthMax = 0;
+      device->lastChangeMSec = 0;
+
+      device->busyPercent = 0;
+      device->meanWaitMS = 0;
+      device->meanDepth = 0.0;
+
+      deviceIndex++;
+   }
+
+   // no device report line yet
+   simContext->logDeviceId = -1;
+}
+
+/*
+Funtion name: findDeviceId
+Algorithm: looks a dev op device name up in the device names
+Precondition: deviceName is a C-Style string
+Postcondiditon: returns the device code of the name
+Exceptions: returns -1 for a name that is not a device
+Note: none
+*/
+int findDeviceId( char *deviceName )
+{
+   // initialize variables
+   int deviceIndex = 0;
+
+   // loop through the names
+   while( deviceIndex < DEVICE_COUNT )
+   {
+      // function: compareString
+      if( compareString( DEVICE_NAMES[ deviceIndex ], deviceName ) == STR_EQ )
+      {
+         return deviceIndex;
+      }
+
+      deviceIndex++;
+   }
+
+   return -1;
+}
+
+/*
+Funtion name: getDeviceName
+Algorithm: returns the dev op name of the device code
+Precondition: deviceId is a device code
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+char *getDeviceName( int deviceId )
+{
+   return DEVICE_NAMES[ deviceId ];
+}
+
+/*
+Funtion name: hasLimitedDevice
+Algorithm: checks the device table for a device with limited channels
+Precondition: config data is uploaded
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+Boolean hasLimitedDevice( ConfigDataType *configPtr )
+{
+   // initialize variables
+   int deviceIndex = 0;
+
+   // loop across the devices
+   while( deviceIndex < DEVICE_COUNT )
+   {
+      if( configPtr->deviceTable[ deviceIndex ].channelCount > 0 )
+      {
+         return True;
+      }
+
+      deviceIndex++;
+   }
+
+   return False;
+}
+
+/*
+Funtion name: getDeviceOpMS
+Algorithm: returns the ms of a dev op, its cycles times the input or
+           output cycle time of its device
+Precondition: op code device id was resolved when it was read
+Postcondiditon: none
+Exceptions: an op that is not on a device uses the I/O cycle time
+Note: none
+*/
+int getDeviceOpMS( ConfigDataType *configPtr, OpCodeType *opCode )
+{
+   // check for an op that is not on a device
+   if( opCode->deviceId < 0 )
+   {
+      return opCode->intArg2 * configPtr->ioCycleRate;
+   }
+
+   // check for an output op
+      // function: compareString
+   if( compareString( opCode->inOutArg, "out" ) == STR_EQ )
+   {
+      return opCode->intArg2
+                  * configPtr->deviceTable[ opCode->deviceId ].outCycleRate;
+   }
+
+   // otherwise, assume an input op
+   return opCode->intArg2
+                   * configPtr->deviceTable[ opCode->deviceId ].inCycleRate;
+}
+
+/*
+Funtion name: requestDevice
+Algorithm: starts the current IO op of the process on a free channel of
+           its device, or adds the process to the device wait list
+Precondition: PCB is going from RUNNING to BLOCKED on a dev op, or on a
+              page fault
+Postcondiditon: PCB is in the event queue of its run queue, or waiting
+Exceptions: on a device with unlimited channels the op starts at once
+Note: the wait list keeps request order, the disk order picks from it; a
+      page fault is an op on the swap device
+*/
+void requestDevice( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   int opDeviceId = pcb->currentOpCode->deviceId;
+   SimDevice *device;
+
+   // check for a page fault
+   if( pcb->swapPageCount > 0 )
+   {
+      opDeviceId = DEVICE_SWAP;
+   }
+
+   // take the device of the op, if its channels are limited
+   pcb->deviceId = -1;
+
+   if( opDeviceId >= 0
+                    && simContext->deviceArray[ opDeviceId ].channelCount > 0 )
+   {
+      pcb->deviceId = opDeviceId;
+   }
+
+   // check for a device with unlimited channels
+   if( pcb->deviceId < 0 )
+   {
+      // the IO op completes its ms from now
+         // function: addDeviceEvent
+      pcb->ioDeadline = simContext->simMSec + pcb->opMSLeft;
+      addDeviceEvent( simContext, pcb );
+
+      return;
+   }
+
+   // keep the request
+   device = &simContext->deviceArray[ pcb->deviceId ];
+   device->requestCount++;
+
+   pcb->ioTrack = pcb->currentOpCode->intArg3;
+   pcb->ioRequestMSec = simContext->simMSec;
+
+   // check for a free channel
+   if( device->busyChannels < device->channelCount )
+   {
+      // function: startDeviceService
+      startDeviceService( simContext, pcb );
+   }
+   // otherwise, wait behind the other requests
+   else
+   {
+      // function: countDeviceDepth
+      countDeviceDepth( simContext, device );
+
+      pcb->nextWaiting = NULL;
+
+      if( device->waitTail == NULL )
+      {
+         device->waitHead = pcb;
+      }
+      else
+      {
+         device->waitTail->nextWaiting = pcb;
+      }
+
+      device->waitTail = pcb;
+      device->waitCount++;
+
+      if( device->waitCount > device->depthMax )
+      {
+         device->depthMax = device->waitCount;
+      }
+
+      // log event
+         // function: displayAndLog
+      displayAndLog( simContext, pcb, DEVICE_WAIT, NONE );
+   }
+}
+
+/*
+Funtion name: releaseDevice
+Algorithm: frees the channel of a finished IO op and starts the next
+           waiting request on it, chosen by the device service order
+Precondition: PCB is leaving BLOCKED with its IO op complete
+Postcondiditon: the channel serves the next request, or is idle
+Exceptions: an op that held no channel releases nothing
+Note: none
+*/
+void releaseDevice( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   SimDevice *device;
+   PCB *nextPcb;
+
+   // check for an op on an unlimited device
+   if( pcb->deviceId < 0 )
+   {
+      return;
+   }
+
+   // free the channel
+   device = &simContext->deviceArray[ pcb->deviceId ];
+   device->busyChannels--;
+   pcb->deviceId = -1;
+
+   // check for a waiting request
+   if( device->waitCount > 0 )
+   {
+      // take the next request in service order
+         // function: countDeviceDepth, takeNextWaiter
+      countDeviceDepth( simContext, device );
+      nextPcb = takeNextWaiter( simContext, device );
+
+      // log event
+         // function: displayAndLog
+      displayAndLog( simContext, nextPcb, DEVICE_START, NONE );
+
+      // function: startDeviceService
+      startDeviceService( simContext, nextPcb );
+   }
+}
+
+/*
+Funtion name: startDeviceService
+Algorithm: puts the request on a channel of its device; a disk request
+           first seeks from the head track to its own, then the op runs
+Precondition: PCB holds its device and a channel is free
+Postcondiditon: PCB is in the event queue, the device summary counts it
+Exceptions: none
+Note: the seek time is waited out but not charged to the process
+*/
+void startDeviceService( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   SimDevice *device = &simContext->deviceArray[ pcb->deviceId ];
+   int seekMS = 0;
+   int waitMS = simContext->simMSec - pcb->ioRequestMSec;
+   int trackCount;
+
+   // take the channel
+   device->busyChannels++;
+
+   // check for a disk request, find the seek from the head track
+   if( pcb->deviceId == DEVICE_HARD_DRIVE )
+   {
+      trackCount = pcb->ioTrack - device->headTrack;
+
+      if( trackCount < 0 )
+      {
+         trackCount = -trackCount;
+      }
+
+      seekMS = trackCount * simContext->configPtr->diskSeekRate / 100;
+      device->headTrack = pcb->ioTrack;
+   }
+
+   // add up the wait and the channel time
+   device->waitSumMS = device->waitSumMS + waitMS;
+
+   if( waitMS > device->waitMaxMS )
+   {
+      device->waitMaxMS = waitMS;
+   }
+
+   device->busyMS = device->busyMS + seekMS + pcb->opMSLeft;
+
+   // the IO op completes after the seek and its ms
+      // function: addDeviceEvent
+   pcb->ioDeadline = simContext->simMSec + seekMS + pcb->opMSLeft;
+   addDeviceEvent( simContext, pcb );
+}
+
+/*
+Funtion name: addDeviceEvent
+Algorithm: adds the IO completion of a blocked PCB to the event heap of
+           its core, or to the event queue of a single core run
+Precondition: PCB IO deadline is set
+Postcondiditon: PCB is in the event queue
+Exceptions: none
+Note: none
+*/
+void addDeviceEvent( SimContext *simContext, PCB *pcb )
+{
+   // check for a multi-core run
+   if( simContext->coreArray != NULL )
+   {
+      // function: addHeapNode
+      addHeapNode( &simContext->coreArray[ pcb->coreId ].eventHeap, pcb );
+   }
+   // otherwise, assume the context event queue
+   else
+   {
+      // function: addEventNode
+      addEventNode( simContext, pcb );
+   }
+}
+
+/*
+Funtion name: takeNextWaiter
+Algorithm: takes the request the device serves next out of its wait list;
+           the oldest request, or for the disk the nearest track ahead of
+           the head, sweeping back at the last request ( SCAN ) or jumping
+           to the lowest track ( C-LOOK )
+Precondition: device has a waiting request
+Postcondiditon: returned PCB is out of the wait list
+Exceptions: none
+Note: equal tracks are served oldest request first
+*/
+PCB *takeNextWaiter( SimContext *simContext, SimDevice *device )
+{
+   // initialize variables
+   int diskOrderCode = simContext->configPtr->diskOrderCode;
+   PCB *nextPcb = device->waitHead;
+
+   // check for the disk with an ordered service
+   if( device == &simContext->deviceArray[ DEVICE_HARD_DRIVE ]
+                               && diskOrderCode != DISK_ORDER_FIFO_CODE )
+   {
+      // find the nearest track in the sweep direction
+         // function: findDiskWaiter
+      nextPcb = findDiskWaiter( device, device->headTrack,
+                                                      device->headUpFlag );
+
+      // check for no track left that way
+      if( nextPcb == NULL )
+      {
+         // SCAN turns the sweep back
+         if( diskOrderCode == DISK_ORDER_SCAN_CODE )
+         {
+            if( device->headUpFlag == True )
+            {
+               device->headUpFlag = False;
+            }
+            else
+            {
+               device->headUpFlag = True;
+            }
+
+            nextPcb = findDiskWaiter( device, device->headTrack,
+                                                      device->headUpFlag );
+         }
+         // otherwise, C-LOOK starts over at the lowest track
+         else
+         {
+            nextPcb = findDiskWaiter( device, 0, True );
+         }
+      }
+   }
+
+   // function: removeWaiter
+   removeWaiter( device, nextPcb );
+
+   return nextPcb;
+}
+
+/*
+Funtion name: findDiskWaiter
+Algorithm: finds the waiting request with the track nearest the given one,
+           at or above it when moving up, at or below it when moving down
+Precondition: none
+Postcondiditon: wait list is unchanged
+Exceptions: returns null if no request lies in that direction
+Note: none
+*/
+PCB *findDiskWaiter( SimDevice *device, int fromTrack, Boolean upFlag )
+{
+   // initialize variables
+   PCB *localPtr = device->waitHead;
+   PCB *bestPtr = NULL;
+
+   // loop across the wait list
+   while( localPtr != NULL )
+   {
+      // check for a nearer track in the direction
+      if( upFlag == True && localPtr->ioTrack >= fromTrack
+           && ( bestPtr == NULL || localPtr->ioTrack < bestPtr->ioTrack ) )
+      {
+         bestPtr = localPtr;
+      }
+      else if( upFlag == False && localPtr->ioTrack <= fromTrack
+           && ( bestPtr == NULL || localPtr->ioTrack > bestPtr->ioTrack ) )
+      {
+         bestPtr = localPtr;
+      }
+
+      localPtr = localPtr->nextWaiting;
+   }
+
+   return bestPtr;
+}
+
+/*
+Funtion name: removeWaiter
+Algorithm: unlinks a PCB from the device wait list
+Precondition: PCB is in the wait list
+Postcondiditon: PCB is out of the wait list, the wait count is one less
+Exceptions: none
+Note: none
+*/
+void removeWaiter( SimDevice *device, PCB *oldNode )
+{
+   // initialize variables
+   PCB *prevPtr = NULL;
+   PCB *localPtr = device->waitHead;
+
+   // find the node before it
+   while( localPtr != oldNode )
+   {
+      prevPtr = localPtr;
+      localPtr = localPtr->nextWaiting;
+   }
+
+   // link around it
+   if( prevPtr == NULL )
+   {
+      device->waitHead = oldNode->nextWaiting;
+   }
+   else
+   {
+      prevPtr->nextWaiting = oldNode->nextWaiting;
+   }
+
+   if( device->waitTail == oldNode )
+   {
+      device->waitTail = prevPtr;
+   }
+
+   oldNode->nextWaiting = NULL;
+   device->waitCount--;
+}
+
+/*
+Funtion name: countDeviceDepth
+Algorithm: adds the wait count times the ms since the last change to the
+           queue depth sum
+Precondition: called before each change of the wait count
+Postcondiditon: depth sum is current to the simulated time
+Exceptions: none
+Note: none
+*/
+void countDeviceDepth( SimContext *simContext, SimDevice *device )
+{
+   device->depthSumMS = device->depthSumMS + (long long)device->waitCount
+                         * ( simContext->simMSec - device->lastChangeMSec );
+   device->lastChangeMSec = simContext->simMSec;
+}
+
+/*
+Funtion name: reportDevices
+Algorithm: logs the busy time, requests, wait times and queue depth of
+           each device that served a request
+Precondition: every process is in EXIT
+Postcondiditon: device summaries are set and logged
+Exceptions: a device with unlimited channels is not logged
+Note: busy time is over every channel for the whole run
+*/
+void reportDevices( SimContext *simContext )
+{
+   // initialize variables
+   int deviceIndex = 0;
+   int runMS = simContext->simMSec;
+   SimDevice *device;
+
+   // a run of zero length counts as one ms
+   if( runMS <= 0 )
+   {
+      runMS = 1;
+   }
+
+   // loop across the devices
+   while( deviceIndex < DEVICE_COUNT )
+   {
+      device = &simContext->deviceArray[ deviceIndex ];
+
+      // check for a limited device that served a request
+      if( device->requestCount > 0 )
+      {
+         // set the summary
+            // function: countDeviceDepth
+         countDeviceDepth( simContext, device );
+
+         device->busyPercent = (int)( (long long)device->busyMS * 100
+                                          / ( device->channelCount * runMS ) );
+         device->meanWaitMS = (int)( device->waitSumMS
+                                                   / device->requestCount );
+         device->meanDepth = (double)device->depthSumMS / runMS;
+
+         // log event
+            // function: displayAndLog
+         simContext->logDeviceId = deviceIndex;
+         displayAndLog( simContext, NULL, DEVICE_REPORT, NONE );
+         displayAndLog( simContext, NULL, DEVICE_QUEUE_REPORT, NONE );
+      }
+
+      deviceIndex++;
+   }
+
+   simContext->logDeviceId = -1;
+}
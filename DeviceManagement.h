@@ -0,0 +1,27 @@
+// Pre-compiler directive
+#ifndef DEVICE_MANAGEMENT_H
+#define DEVICE_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include "StringUtils.h"
+#include "simulator.h"
+
+// function prototypes
+void initDevices( SimContext *simContext );
+int findDeviceId( char *deviceName );
+char *getDeviceName( int deviceId );
+Boolean hasLimitedDevice( ConfigDataType *configPtr );
+int getDeviceOpMS( ConfigDataType *configPtr, OpCodeType *opCode );
+void requestDevice( SimContext *simContext, PCB *pcb );
+void releaseDevice( SimContext *simContext, PCB *pcb );
+void startDeviceService( SimContext *simContext, PCB *pcb );
+void addDeviceEvent( SimContext *simContext, PCB *pcb );
+PCB *takeNextWaiter( SimContext *simContext, SimDevice *device );
+PCB *findDiskWaiter( SimDevice *device, int fromTrack, Boolean upFlag );
+void removeWaiter( SimDevice *device, PCB *oldNode );
+void countDeviceDepth( SimContext *simContext, SimDevice *device );
+void reportDevices( SimContext *simContext );
+
+#endif   // DEVICE_MANAGEMENT_H
@@ -5,6 +5,8 @@
 #include "MemoryManagement.h"
 #include "CpuManagement.h"
 #include "DisplayLog.h"
+#include "SmpManagement.h"
+#include "DeviceManagement.h"
 #include <pthread.h>
 #include <signal.h>
 
@@ -16,13 +18,12 @@ Postcondiditon: none
 Exceptions: none
 Note: none
 */
-void displayAndLog( int loggingFormatFlag, PCB *pcb, 
-         fileOutputBuffer *fileOutputHead, DisplayCodes arg1, DisplayCodes arg2 )
+void displayAndLog( SimContext *simContext, PCB *pcb, 
+                                       DisplayCodes arg1, DisplayCodes arg2 )
 {
    // initialize variables
    char timeString[ STD_STR_LEN ];
-   char stringBuffer[ STD_STR_LEN ];
-   fileOutputBuffer *localPtr = fileOutputHead;
+   char stringBuffer[ MAX_STR_LEN ];
    
    // allocate mem for the new node
    fileOutputBuffer *newNode = (fileOutputBuffer *)malloc( sizeof( fileOutputBuffer ) );
@@ -31,7 +32,10 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
    if( arg1 == INIT )
    {
       // init the timer
-      accessTimer( 0, timeString );
+      accessTimer( &simContext->timer, ZERO_TIMER, timeString );
+      
+      // start appending after the list head
+      simContext->logListTail = simContext->logListHead;
       
       // record starting msges
       sprintf( stringBuffer, "Running Simulator\n-----------------\n\n%s, OS: Start\n", 
@@ -40,7 +44,7 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
    // otherwise assume this is a timer access
    else
    {
-      accessTimer( 1, timeString );
+      accessTimer( &simContext->timer, LAP_TIMER, timeString );
    }
    
    // start switch statement for the displays
@@ -80,12 +84,284 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
          sprintf( stringBuffer, "%s, OS: Process %d, ended and set to "
          "EXIT state\n", timeString, pcb->pid );
          
+         // check for a process ending past its deadline
+         if( pcb->dueMSec >= 0 && simContext->simMSec > pcb->dueMSec )
+         {
+            sprintf( stringBuffer + getStringLength( stringBuffer ) - 1,
+                     ", %dms past its deadline\n",
+                     simContext->simMSec - pcb->dueMSec );
+         }
+         
          break;
       
       case PCB_SELECT:
       
-         sprintf( stringBuffer, "%s, OS: Process %d selected with %dms remaining\n",  
-                  timeString, pcb->pid, pcb->msLeft);
+         // check for a multi-core run
+         if( simContext->logCoreId >= 0 )
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d selected with %dms "
+                     "remaining on core %d\n", timeString, pcb->pid,
+                     pcb->msLeft, simContext->logCoreId );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d selected with %dms remaining\n",  
+                     timeString, pcb->pid, pcb->msLeft);
+         }
+         
+         break;
+      
+      case PCB_STEAL:
+      
+         sprintf( stringBuffer, "%s, OS: Process %d moved from core %d to "
+                  "idle core %d\n", timeString, pcb->pid, pcb->coreId,
+                  simContext->logCoreId );
+         
+         break;
+      
+      case MLFQ_BOOST:
+      
+         sprintf( stringBuffer, "%s, OS: Priority boost, all processes "
+                  "moved to the top MLFQ level\n", timeString );
+         
+         break;
+      
+      case CORE_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Core %d busy %dms ( %d%% ), "
+                  "%d dispatches, %d steals\n", timeString,
+                  simContext->logCoreId,
+                  simContext->coreArray[ simContext->logCoreId ].busyMS,
+                  getCoreBusyPercent(
+                     &simContext->coreArray[ simContext->logCoreId ],
+                                                   simContext->simMSec ),
+                  simContext->coreArray[ simContext->logCoreId ].dispatchCount,
+                  simContext->coreArray[ simContext->logCoreId ].stealCount );
+         
+         break;
+      
+      case DEADLINE_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Deadlines met by %d of %d "
+                  "processes, %d missed\n", timeString,
+                  simContext->deadlineReport.deadlineCount
+                                 - simContext->deadlineReport.missCount,
+                  simContext->deadlineReport.deadlineCount,
+                  simContext->deadlineReport.missCount );
+         
+         break;
+      
+      case LATENESS_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Lateness min %dms, median %dms, "
+                  "90th %dms, max %dms\n", timeString,
+                  simContext->deadlineReport.latenessMin,
+                  simContext->deadlineReport.latenessMedian,
+                  simContext->deadlineReport.latenessHigh,
+                  simContext->deadlineReport.latenessMax );
+         
+         break;
+      
+      case LOAD_REPORT:
+      
+         // check for a load that passes the EDF test
+         if( simContext->deadlineReport.schedulableFlag == True )
+         {
+            sprintf( stringBuffer, "%s, OS: Deadline load %d%%, cores %d, "
+                     "schedulable under EDF\n", timeString,
+                     simContext->deadlineReport.loadPercent,
+                     simContext->coreCount );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: Deadline load %d%%, cores %d, "
+                     "not schedulable under EDF\n", timeString,
+                     simContext->deadlineReport.loadPercent,
+                     simContext->coreCount );
+         }
+         
+         break;
+      
+      case PROCESS_TIMES:
+      
+         snprintf( stringBuffer, sizeof( stringBuffer ),
+                  "%s, OS: Process %d arrived at %dms, "
+                  "response %dms, turnaround %dms\n", timeString, pcb->pid,
+                  pcb->arrivalMSec, pcb->firstRunMSec - pcb->arrivalMSec,
+                  pcb->exitMSec - pcb->arrivalMSec );
+         
+         break;
+      
+      case MEAN_TIMES:
+      
+         snprintf( stringBuffer, sizeof( stringBuffer ),
+                  "%s, OS: Mean response %dms, mean "
+                  "turnaround %dms\n", timeString,
+                  simContext->meanResponseMS,
+                  simContext->meanTurnaroundMS );
+         
+         break;
+      
+      case DEVICE_WAIT:
+      
+         sprintf( stringBuffer, "%s, OS: Process %d, waits for %s, "
+                  "%d ahead\n", timeString, pcb->pid,
+                  getDeviceName( pcb->deviceId ),
+                  simContext->deviceArray[ pcb->deviceId ].waitCount - 1 );
+         
+         break;
+      
+      case DEVICE_START:
+      
+         // check for a page fault on the swap device
+         if( pcb->swapPageCount > 0 )
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d, swap page in "
+                     "start after %dms wait\n", timeString, pcb->pid,
+                     simContext->simMSec - pcb->ioRequestMSec );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d, %s %sput operation "
+                     "start after %dms wait\n", timeString, pcb->pid,
+                     pcb->currentOpCode->strArg1,
+                     pcb->currentOpCode->inOutArg,
+                     simContext->simMSec - pcb->ioRequestMSec );
+         }
+         
+         break;
+      
+      case DEVICE_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Device %s busy %d%%, channels %d, "
+                  "requests %d\n", timeString,
+                  getDeviceName( simContext->logDeviceId ),
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                               .busyPercent,
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                              .channelCount,
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                            .requestCount );
+         
+         break;
+      
+      case DEVICE_QUEUE_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Device %s wait mean %dms, max %dms, "
+                  "depth mean %4.2f, max %d\n", timeString,
+                  getDeviceName( simContext->logDeviceId ),
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                                .meanWaitMS,
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                                 .waitMaxMS,
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                                 .meanDepth,
+                  simContext->deviceArray[ simContext->logDeviceId ]
+                                                                .depthMax );
+         
+         break;
+      
+      case OVERHEAD_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Overhead %dms, %4.2f%% of cpu "
+                  "time, switches %d, interrupts %d\n", timeString,
+                  simContext->overheadMS, simContext->overheadPercent,
+                  simContext->switchCount, simContext->interruptCount );
+         
+         break;
+      
+      case PLACEMENT_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Placement %s, requests %d, "
+                  "failed %d ( %4.2f%% )\n", timeString,
+                  getPlacementName(
+                              simContext->configPtr->memPlacementCode ),
+                  simContext->placementReport.requestCount,
+                  simContext->placementReport.failCount,
+                  simContext->placementReport.failPercent );
+         
+         break;
+      
+      case PLACEMENT_SEARCH_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Placement search mean %4.2f, "
+                  "max %d\n", timeString,
+                  simContext->placementReport.meanSearch,
+                  simContext->placementReport.searchMax );
+         
+         break;
+      
+      case FRAGMENTATION_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Fragmentation mean %4.2f%%, "
+                  "max %4.2f%%, internal %4.2f%%\n", timeString,
+                  simContext->placementReport.meanExternal,
+                  simContext->placementReport.externalMax,
+                  simContext->placementReport.internalPercent );
+         
+         break;
+      
+      case PROCESS_PAGING:
+      
+         sprintf( stringBuffer, "%s, OS: Process %d, TLB hits %4.2f%%, "
+                  "translation %dms\n", timeString, pcb->pid,
+                  pcb->tlbHitPercent, pcb->translationMS );
+         
+         break;
+      
+      case PAGING_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: TLB hits %4.2f%% of %d lookups, "
+                  "translation %dms\n", timeString,
+                  simContext->pagingReport.hitPercent,
+                  simContext->pagingReport.hitCount
+                                       + simContext->pagingReport.missCount,
+                  simContext->pagingReport.translationMS );
+         
+         break;
+      
+      case PAGE_FAULT:
+      
+         sprintf( stringBuffer, "%s, OS: Process %d, page fault, %d pages "
+                  "from swap\n", timeString, pcb->pid, pcb->swapPageCount );
+         
+         break;
+      
+      case PROCESS_FAULTS:
+      
+         sprintf( stringBuffer, "%s, OS: Process %d, page faults %d, "
+                  "fault rate %4.2f%%\n", timeString, pcb->pid,
+                  pcb->pageFaultCount, pcb->faultPercent );
+         
+         break;
+      
+      case FAULT_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Page faults %d, evictions %d, "
+                  "fault rate %4.2f%%\n", timeString,
+                  simContext->pagingReport.faultCount,
+                  simContext->pagingReport.evictCount,
+                  simContext->pagingReport.faultPercent );
+         
+         break;
+      
+      case THRASH_SPAN:
+      
+         sprintf( stringBuffer, "%s, OS: Thrashing from %dms to %dms, "
+                  "evictions %4.2f%%\n", timeString,
+                  simContext->pagingReport.spanStartMSec,
+                  simContext->pagingReport.spanEndMSec,
+                  simContext->pagingReport.spanPercent );
+         
+         break;
+      
+      case THRASH_REPORT:
+      
+         sprintf( stringBuffer, "%s, OS: Thrashing in %d of %d windows "
+                  "of %dms\n", timeString,
+                  simContext->pagingReport.thrashCount,
+                  simContext->windowCount,
+                  simContext->configPtr->workingSetMS );
          
          break;
       
@@ -125,6 +401,13 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
             timeString, pcb->pid );
          }
          
+         // check for a multi-core run, name the core before the newline
+         if( simContext->logCoreId >= 0 )
+         {
+            sprintf( stringBuffer + getStringLength( stringBuffer ) - 1,
+                     " on core %d\n", simContext->logCoreId );
+         }
+         
          break;
       
       case MEM_START:
@@ -137,9 +420,21 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
       
       case MEM_SUCCESS:
          
-         sprintf( stringBuffer, "%s, OS: successful mem %s "
-         "request\n", timeString, pcb->currentOpCode->
-         strArg1);
+         // check for an allocation the MMU placed
+         if( pcb->currentOpCode->intArg2 == MEM_PLACED_BASE
+            && compareString( pcb->currentOpCode->strArg1, "allocate" )
+                                                                 == STR_EQ )
+         {
+            sprintf( stringBuffer, "%s, OS: successful mem %s "
+            "request at %d\n", timeString, pcb->currentOpCode->
+            strArg1, pcb->placedBase );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: successful mem %s "
+            "request\n", timeString, pcb->currentOpCode->
+            strArg1);
+         }
          
          break;
       
@@ -183,18 +478,36 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
       
       case BLOCKED_INT:
       
-         sprintf( stringBuffer, "%s, OS: Process %d, "
-         "blocked for %sput operation\n",
-         timeString, pcb->pid, pcb->currentOpCode->inOutArg );
+         // check for a page fault on the swap device
+         if( pcb->swapPageCount > 0 )
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d, "
+            "blocked for swap page in\n", timeString, pcb->pid );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: Process %d, "
+            "blocked for %sput operation\n",
+            timeString, pcb->pid, pcb->currentOpCode->inOutArg );
+         }
          
          break;
       
       case FINISH_INT:
       
-         sprintf( stringBuffer, "%s, OS: Interrupted by Process %d %s "
-         "%sput operation\n", 
-         timeString, pcb->pid, pcb->currentOpCode->strArg1, 
-         pcb->currentOpCode->inOutArg );
+         // check for a page fault on the swap device
+         if( pcb->swapPageCount > 0 )
+         {
+            sprintf( stringBuffer, "%s, OS: Interrupted by Process %d "
+            "swap page in\n", timeString, pcb->pid );
+         }
+         else
+         {
+            sprintf( stringBuffer, "%s, OS: Interrupted by Process %d %s "
+            "%sput operation\n", 
+            timeString, pcb->pid, pcb->currentOpCode->strArg1, 
+            pcb->currentOpCode->inOutArg );
+         }
          
          break;
          
@@ -211,19 +524,25 @@ void displayAndLog( int loggingFormatFlag, PCB *pcb,
 
    }
    // check if we want to print to monitor, and if so, print
-   if( loggingFormatFlag == LOGTO_MONITOR_CODE ||
-         loggingFormatFlag == LOGTO_BOTH_CODE )
+   if( simContext->quietFlag == False
+       && ( simContext->loggingFormatFlag == LOGTO_MONITOR_CODE ||
+            simContext->loggingFormatFlag == LOGTO_BOTH_CODE ) )
    {
-      printf( stringBuffer );
+      printf( "%s", stringBuffer );
    }
    
-   if( stringBuffer != NULL )
+   // only keep the line when it will be written to the log file
+   if( simContext->loggingFormatFlag == LOGTO_FILE_CODE ||
+         simContext->loggingFormatFlag == LOGTO_BOTH_CODE )
    {
       // set the new node's string
       copyString( newNode->lineString, stringBuffer );
       
-      // add this node to the linked list of strings for file output
-      addListNode( localPtr, newNode );
+      // add this node to the end of the linked list of strings for file output
+         // function: addListNode
+      simContext->logListTail->nextNode = 
+               addListNode( simContext->logListTail->nextNode, newNode );
+      simContext->logListTail = simContext->logListTail->nextNode;
    }
    
    // free new node memory
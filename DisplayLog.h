@@ -31,13 +31,36 @@ typedef enum {
    CPU_IDLE,
    QUANT_INT,
    BLOCKED_INT,
-   FINISH_INT }DisplayCodes;
+   FINISH_INT,
+   PCB_STEAL,
+   CORE_REPORT,
+   MLFQ_BOOST,
+   DEADLINE_REPORT,
+   LATENESS_REPORT,
+   LOAD_REPORT,
+   PROCESS_TIMES,
+   MEAN_TIMES,
+   DEVICE_WAIT,
+   DEVICE_START,
+   DEVICE_REPORT,
+   DEVICE_QUEUE_REPORT,
+   OVERHEAD_REPORT,
+   PLACEMENT_REPORT,
+   PLACEMENT_SEARCH_REPORT,
+   FRAGMENTATION_REPORT,
+   PROCESS_PAGING,
+   PAGING_REPORT,
+   PAGE_FAULT,
+   PROCESS_FAULTS,
+   FAULT_REPORT,
+   THRASH_SPAN,
+   THRASH_REPORT }DisplayCodes;
    
 // struct for the file output buffer
 typedef struct fileOutputBuffer
 {
    //string for specified file line
-   char lineString [ 100 ];
+   char lineString [ 200 ];
 
    // pointer to next line
    struct fileOutputBuffer *nextNode;
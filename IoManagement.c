@@ -0,0 +1,683 @@
+// needed for clock_gettime and pthread_condattr_setclock
+#define _POSIX_C_SOURCE 200112L
+
+#include "IoManagement.h"
+#include <time.h>
+
+/*
+Funtion name: initIoPool
+Algorithm: sets up an IO pool with no workers and no requests
+Precondition: none
+Postcondiditon: pool is empty, nothing is allocated until it is started
+Exceptions: none
+Note: virtual time runs never start the pool
+*/
+void initIoPool( IoPool *ioPool )
+{
+   ioPool->workerCount = 0;
+
+   ioPool->ringArray = NULL;
+   ioPool->sequenceArray = NULL;
+   ioPool->ringMask = 0;
+   ioPool->enqueuePos = 0;
+   ioPool->dequeuePos = 0;
+
+   ioPool->queuedCount = 0;
+   ioPool->idleCount = 0;
+
+   ioPool->heapArray = NULL;
+   ioPool->heapSize = 0;
+   ioPool->heapCapacity = 0;
+
+   ioPool->completionHead = NULL;
+   ioPool->freeListHead = NULL;
+   ioPool->allocatedHead = NULL;
+
+   ioPool->stopFlag = False;
+}
+
+/*
+Funtion name: startIoPool
+Algorithm: sizes the submission ring to twice the process count (a power
+           of two, at least 64), sets up the wakeups and starts the fixed
+           number of worker threads
+Precondition: pool was set up by initIoPool
+Postcondiditon: workers are running and waiting for requests
+Exceptions: none
+Note: the worker wakeup uses CLOCK_MONOTONIC, the clock of the timer
+*/
+void startIoPool( IoPool *ioPool, int processCount )
+{
+   // initialize variables
+   unsigned long ringCapacity = 64;
+   unsigned long ringIndex = 0;
+   pthread_condattr_t conditionAttr;
+
+   // find the ring size
+   while( ringCapacity < (unsigned long) processCount * 2 )
+   {
+      ringCapacity = ringCapacity * 2;
+   }
+
+   // allocate the ring, every slot free for the push of its own position
+      // function: malloc
+   ioPool->ringArray = (IoRequest **)malloc(
+                                     sizeof( IoRequest * ) * ringCapacity );
+   ioPool->sequenceArray = (unsigned long *)malloc(
+                                     sizeof( unsigned long ) * ringCapacity );
+   ioPool->ringMask = ringCapacity - 1;
+
+   while( ringIndex < ringCapacity )
+   {
+      ioPool->sequenceArray[ ringIndex ] = ringIndex;
+      ringIndex++;
+   }
+
+   // set up the wakeups
+      // function: pthread_mutex_init, pthread_cond_init,
+      //           pthread_condattr_setclock
+   pthread_mutex_init( &ioPool->poolMutex, NULL );
+   pthread_cond_init( &ioPool->completionCondition, NULL );
+
+   pthread_condattr_init( &conditionAttr );
+   pthread_condattr_setclock( &conditionAttr, CLOCK_MONOTONIC );
+   pthread_cond_init( &ioPool->workCondition, &conditionAttr );
+   pthread_condattr_destroy( &conditionAttr );
+
+   // start the workers
+      // function: pthread_create
+   while( ioPool->workerCount < IO_WORKER_COUNT )
+   {
+      pthread_create( &ioPool->workerArray[ ioPool->workerCount ], NULL,
+                                                      runIoWorker, ioPool );
+      ioPool->workerCount++;
+   }
+}
+
+/*
+Funtion name: stopIoPool
+Algorithm: tells the workers to stop, wakes and joins them, then returns
+           every request and the ring to the OS
+Precondition: none
+Postcondiditon: no worker is running, pool is empty again
+Exceptions: none
+Note: requests still waiting for their device time are dropped, no
+      process waits on them once the run is over; does nothing for a
+      pool never started
+*/
+void stopIoPool( IoPool *ioPool )
+{
+   // initialize variables
+   IoRequest *localPtr;
+   IoRequest *nextPtr;
+   int workerIndex = 0;
+
+   // check for a pool that was never started
+   if( ioPool->workerCount == 0 )
+   {
+      return;
+   }
+
+   // wake every worker with the stop flag set
+      // function: pthread_mutex_lock, pthread_cond_broadcast
+   pthread_mutex_lock( &ioPool->poolMutex );
+
+   ioPool->stopFlag = True;
+   pthread_cond_broadcast( &ioPool->workCondition );
+
+   pthread_mutex_unlock( &ioPool->poolMutex );
+
+   // wait for the workers
+      // function: pthread_join
+   while( workerIndex < ioPool->workerCount )
+   {
+      pthread_join( ioPool->workerArray[ workerIndex ], NULL );
+      workerIndex++;
+   }
+
+   // free every request ever allocated
+      // function: free
+   localPtr = ioPool->allocatedHead;
+
+   while( localPtr != NULL )
+   {
+      nextPtr = localPtr->nextAllocated;
+      free( localPtr );
+      localPtr = nextPtr;
+   }
+
+   free( ioPool->ringArray );
+   free( ioPool->sequenceArray );
+   free( ioPool->heapArray );
+
+   // release the wakeups
+      // function: pthread_mutex_destroy, pthread_cond_destroy
+   pthread_mutex_destroy( &ioPool->poolMutex );
+   pthread_cond_destroy( &ioPool->workCondition );
+   pthread_cond_destroy( &ioPool->completionCondition );
+
+   // function: initIoPool
+   initIoPool( ioPool );
+}
+
+/*
+Funtion name: submitIoRequest
+Algorithm: takes a request from the free list (or allocates one), sets its
+           device finish time from the timer's current deadline and pushes
+           it on the submission ring; a worker is only woken if one is
+           asleep
+Precondition: PCB current op is the IO op starting now
+Postcondiditon: a worker will time the IO op, and the PCB is pending
+                until its completion is drained
+Exceptions: none
+Note: a full ring leaves the op timed by the scheduler alone,
+      does nothing for a pool that is not started
+*/
+void submitIoRequest( IoPool *ioPool, SimTimer *timer, PCB *pcb )
+{
+   // initialize variables
+   IoRequest *request = ioPool->freeListHead;
+
+   // check for a pool that is not started
+   if( ioPool->workerCount == 0 )
+   {
+      return;
+   }
+
+   // check for a recycled request
+   if( request != NULL )
+   {
+      ioPool->freeListHead = request->nextRequest;
+   }
+   // otherwise, allocate a new one
+   else
+   {
+      // function: malloc
+      request = (IoRequest *)malloc( sizeof( IoRequest ) );
+      request->nextAllocated = ioPool->allocatedHead;
+      ioPool->allocatedHead = request;
+   }
+
+   // the device finishes when the scheduler's clock reaches the op's end
+   request->pcb = pcb;
+   request->wakeNSec = timer->pacingNSec
+         + (long long) ( pcb->opMSLeft * timer->timeScale * 1000000.0 );
+   request->nextRequest = NULL;
+
+   // check for a full ring
+      // function: pushIoRing
+   if( pushIoRing( ioPool, request ) == False )
+   {
+      // recycle the request
+      request->nextRequest = ioPool->freeListHead;
+      ioPool->freeListHead = request;
+
+      return;
+   }
+
+   // the process waits for this request before it leaves IO
+   pcb->ioPendingFlag = True;
+
+   // count the request, then wake a worker if one is asleep
+      // function: __atomic_add_fetch, __atomic_load_n
+   __atomic_add_fetch( &ioPool->queuedCount, 1, __ATOMIC_SEQ_CST );
+
+   if( __atomic_load_n( &ioPool->idleCount, __ATOMIC_SEQ_CST ) > 0 )
+   {
+      // function: pthread_mutex_lock, pthread_cond_signal
+      pthread_mutex_lock( &ioPool->poolMutex );
+      pthread_cond_signal( &ioPool->workCondition );
+      pthread_mutex_unlock( &ioPool->poolMutex );
+   }
+}
+
+/*
+Funtion name: drainIoCompletions
+Algorithm: takes the whole completion stack at once, clears the pending
+           flag of each request's process and moves the requests to the
+           free list
+Precondition: called by the scheduler thread only
+Postcondiditon: finished requests can be reused
+Exceptions: none
+Note: none
+*/
+void drainIoCompletions( IoPool *ioPool )
+{
+   // initialize variables
+   IoRequest *localPtr;
+   IoRequest *nextPtr;
+
+   // check for a pool that is not started
+   if( ioPool->workerCount == 0 )
+   {
+      return;
+   }
+
+   // take the whole stack
+      // function: __atomic_exchange_n
+   localPtr = __atomic_exchange_n( &ioPool->completionHead, NULL,
+                                                         __ATOMIC_ACQUIRE );
+
+   // end each request's IO and move it to the free list
+   while( localPtr != NULL )
+   {
+      nextPtr = localPtr->nextRequest;
+
+      localPtr->pcb->ioPendingFlag = False;
+
+      localPtr->nextRequest = ioPool->freeListHead;
+      ioPool->freeListHead = localPtr;
+
+      localPtr = nextPtr;
+   }
+}
+
+/*
+Funtion name: awaitIoCompletion
+Algorithm: drains the completion stack, and sleeps on the completion
+           condition until a worker has pushed the process' request
+Precondition: called by the scheduler thread only
+Postcondiditon: the process' IO op is finished
+Exceptions: none
+Note: returns at once for a process no worker holds a request for;
+      workers push completions under the pool mutex, so the wakeup
+      can not be lost between the look at the stack and the wait
+*/
+void awaitIoCompletion( IoPool *ioPool, PCB *pcb )
+{
+   // take what is finished so far
+      // function: drainIoCompletions
+   drainIoCompletions( ioPool );
+
+   // loop until the process' request is finished
+   while( pcb->ioPendingFlag == True )
+   {
+      // function: pthread_mutex_lock, __atomic_load_n, pthread_cond_wait
+      pthread_mutex_lock( &ioPool->poolMutex );
+
+      while( __atomic_load_n( &ioPool->completionHead,
+                                                __ATOMIC_ACQUIRE ) == NULL )
+      {
+         pthread_cond_wait( &ioPool->completionCondition,
+                                                      &ioPool->poolMutex );
+      }
+
+      pthread_mutex_unlock( &ioPool->poolMutex );
+
+      // function: drainIoCompletions
+      drainIoCompletions( ioPool );
+   }
+}
+
+/*
+Funtion name: pushIoRing
+Algorithm: claims the next ring position with a compare and swap once its
+           slot's sequence shows it is free, stores the request, then
+           publishes the slot by advancing its sequence
+Precondition: none
+Postcondiditon: returns True if the request is in the ring
+Exceptions: returns False if the ring is full
+Note: lock-free, safe for any number of pushing and popping threads
+*/
+Boolean pushIoRing( IoPool *ioPool, IoRequest *request )
+{
+   // initialize variables
+      // function: __atomic_load_n
+   unsigned long ringPos = __atomic_load_n( &ioPool->enqueuePos,
+                                                         __ATOMIC_RELAXED );
+   unsigned long slotSequence;
+   long slotLead;
+   Boolean claimedFlag = False;
+
+   // loop until a position is claimed
+   while( claimedFlag == False )
+   {
+      slotSequence = __atomic_load_n(
+          &ioPool->sequenceArray[ ringPos & ioPool->ringMask ],
+                                                         __ATOMIC_ACQUIRE );
+      slotLead = (long) ( slotSequence - ringPos );
+
+      // check for a free slot, and claim its position
+         // function: __atomic_compare_exchange_n
+      if( slotLead == 0 )
+      {
+         if( __atomic_compare_exchange_n( &ioPool->enqueuePos, &ringPos,
+                ringPos + 1, True, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+         {
+            claimedFlag = True;
+         }
+      }
+      // otherwise, check for a slot not yet popped ( full ring )
+      else if( slotLead < 0 )
+      {
+         return False;
+      }
+      // otherwise, another push claimed it, reload the position
+      else
+      {
+         ringPos = __atomic_load_n( &ioPool->enqueuePos, __ATOMIC_RELAXED );
+      }
+   }
+
+   // store the request and publish the slot
+      // function: __atomic_store_n
+   ioPool->ringArray[ ringPos & ioPool->ringMask ] = request;
+
+   __atomic_store_n( &ioPool->sequenceArray[ ringPos & ioPool->ringMask ],
+                                          ringPos + 1, __ATOMIC_RELEASE );
+
+   return True;
+}
+
+/*
+Funtion name: popIoRing
+Algorithm: claims the oldest ring position with a compare and swap once
+           its slot's sequence shows it is published, takes the request,
+           then frees the slot for the push one lap later
+Precondition: none
+Postcondiditon: returns the oldest request
+Exceptions: returns null if the ring is empty
+Note: lock-free, safe for any number of pushing and popping threads
+*/
+IoRequest *popIoRing( IoPool *ioPool )
+{
+   // initialize variables
+      // function: __atomic_load_n
+   unsigned long ringPos = __atomic_load_n( &ioPool->dequeuePos,
+                                                         __ATOMIC_RELAXED );
+   unsigned long slotSequence;
+   long slotLead;
+   Boolean claimedFlag = False;
+   IoRequest *request;
+
+   // loop until a position is claimed
+   while( claimedFlag == False )
+   {
+      slotSequence = __atomic_load_n(
+          &ioPool->sequenceArray[ ringPos & ioPool->ringMask ],
+                                                         __ATOMIC_ACQUIRE );
+      slotLead = (long) ( slotSequence - ( ringPos + 1 ) );
+
+      // check for a published slot, and claim its position
+         // function: __atomic_compare_exchange_n
+      if( slotLead == 0 )
+      {
+         if( __atomic_compare_exchange_n( &ioPool->dequeuePos, &ringPos,
+                ringPos + 1, True, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+         {
+            claimedFlag = True;
+         }
+      }
+      // otherwise, check for a slot not yet pushed ( empty ring )
+      else if( slotLead < 0 )
+      {
+         return NULL;
+      }
+      // otherwise, another pop claimed it, reload the position
+      else
+      {
+         ringPos = __atomic_load_n( &ioPool->dequeuePos, __ATOMIC_RELAXED );
+      }
+   }
+
+   // take the request and free the slot for the next lap
+      // function: __atomic_store_n
+   request = ioPool->ringArray[ ringPos & ioPool->ringMask ];
+
+   __atomic_store_n( &ioPool->sequenceArray[ ringPos & ioPool->ringMask ],
+                     ringPos + ioPool->ringMask + 1, __ATOMIC_RELEASE );
+
+   return request;
+}
+
+/*
+Funtion name: pushIoCompletion
+Algorithm: links the request on top of the completion stack with a
+           compare and swap
+Precondition: request is held by the calling worker
+Postcondiditon: request is on the completion stack
+Exceptions: none
+Note: the scheduler only ever takes the whole stack, so no popped node
+      can come back underneath a push
+*/
+void pushIoCompletion( IoPool *ioPool, IoRequest *request )
+{
+   // initialize variables
+      // function: __atomic_load_n
+   IoRequest *stackHead = __atomic_load_n( &ioPool->completionHead,
+                                                         __ATOMIC_RELAXED );
+   Boolean pushedFlag = False;
+
+   // loop until the request is on top
+   while( pushedFlag == False )
+   {
+      request->nextRequest = stackHead;
+
+      // function: __atomic_compare_exchange_n
+      if( __atomic_compare_exchange_n( &ioPool->completionHead, &stackHead,
+                     request, True, __ATOMIC_RELEASE, __ATOMIC_RELAXED ) )
+      {
+         pushedFlag = True;
+      }
+   }
+}
+
+/*
+Funtion name: addIoHeap
+Algorithm: places the request at the end of the heap and sifts it up by
+           device finish time, doubling the array when it is full
+Precondition: caller holds the pool mutex
+Postcondiditon: request is in the heap
+Exceptions: none
+Note: assumes memory access/availability
+*/
+void addIoHeap( IoPool *ioPool, IoRequest *request )
+{
+   // initialize variables
+   int heapIndex = ioPool->heapSize;
+   int parentIndex;
+
+   // check for a full array
+   if( ioPool->heapSize == ioPool->heapCapacity )
+   {
+      // double the capacity, starting small
+      if( ioPool->heapCapacity == 0 )
+      {
+         ioPool->heapCapacity = 16;
+      }
+      else
+      {
+         ioPool->heapCapacity *= 2;
+      }
+
+      // function: realloc
+      ioPool->heapArray = (IoRequest **)realloc( ioPool->heapArray,
+                             sizeof( IoRequest * ) * ioPool->heapCapacity );
+   }
+
+   ioPool->heapSize++;
+
+   // loop while the request finishes before its parent
+   while( heapIndex > 0 )
+   {
+      parentIndex = ( heapIndex - 1 ) / 2;
+
+      // check for the parent finishing first
+      if( ioPool->heapArray[ parentIndex ]->wakeNSec <= request->wakeNSec )
+      {
+         break;
+      }
+
+      // move the parent down
+      ioPool->heapArray[ heapIndex ] = ioPool->heapArray[ parentIndex ];
+
+      heapIndex = parentIndex;
+   }
+
+   // place the request
+   ioPool->heapArray[ heapIndex ] = request;
+}
+
+/*
+Funtion name: takeIoHeap
+Algorithm: takes the request that finishes first, moves the last request
+           into its place and sifts it down by device finish time
+Precondition: caller holds the pool mutex, heap is not empty
+Postcondiditon: returns the earliest request, now out of the heap
+Exceptions: none
+Note: none
+*/
+IoRequest *takeIoHeap( IoPool *ioPool )
+{
+   // initialize variables
+   IoRequest *request = ioPool->heapArray[ 0 ];
+   IoRequest *movingRequest;
+   int heapIndex = 0;
+   int childIndex;
+
+   // take the last request off the end
+   ioPool->heapSize--;
+   movingRequest = ioPool->heapArray[ ioPool->heapSize ];
+
+   // loop while the moving request has a child
+   while( 2 * heapIndex + 1 < ioPool->heapSize )
+   {
+      // find the child that finishes first
+      childIndex = 2 * heapIndex + 1;
+
+      if( childIndex + 1 < ioPool->heapSize
+          && ioPool->heapArray[ childIndex + 1 ]->wakeNSec
+                              < ioPool->heapArray[ childIndex ]->wakeNSec )
+      {
+         childIndex++;
+      }
+
+      // check for the moving request finishing first
+      if( movingRequest->wakeNSec
+                            <= ioPool->heapArray[ childIndex ]->wakeNSec )
+      {
+         break;
+      }
+
+      // move the child up
+      ioPool->heapArray[ heapIndex ] = ioPool->heapArray[ childIndex ];
+
+      heapIndex = childIndex;
+   }
+
+   // place the moving request
+   ioPool->heapArray[ heapIndex ] = movingRequest;
+
+   return request;
+}
+
+/*
+Funtion name: getMonotonicNSec
+Algorithm: reads CLOCK_MONOTONIC in nanoseconds
+Precondition: none
+Postcondiditon: returns the current time
+Exceptions: none
+Note: none
+*/
+long long getMonotonicNSec()
+{
+   // initialize variables
+   struct timespec nowData;
+
+   // function: clock_gettime
+   clock_gettime( CLOCK_MONOTONIC, &nowData );
+
+   return (long long) nowData.tv_sec * 1000000000
+                                               + (long long) nowData.tv_nsec;
+}
+
+/*
+Funtion name: runIoWorker
+Algorithm: moves the requests off the submission ring into the heap, then
+           finishes the request with the earliest device finish time once
+           it is reached, pushing it on the completion stack and waking
+           the scheduler; sleeps on the work condition until that finish
+           time, or while there is no request at all
+Precondition: pool was started
+Postcondiditon: returns once the pool is stopped
+Exceptions: none
+Note: every worker serves the one heap, so a short op is never held up
+      behind longer ones submitted before it; the idle count is raised
+      before the last look at the queued count, and the scheduler raises
+      the queued count before looking at the idle count, so a wakeup for
+      a new, possibly earlier, request is never lost
+*/
+void *runIoWorker( void *ioPoolPtr )
+{
+   // initialize variables
+   IoPool *ioPool = (IoPool *) ioPoolPtr;
+   IoRequest *request;
+   struct timespec wakeData;
+   long long wakeNSec;
+
+   // function: pthread_mutex_lock
+   pthread_mutex_lock( &ioPool->poolMutex );
+
+   // loop until the pool is stopped
+   while( ioPool->stopFlag == False )
+   {
+      // move the submitted requests into the heap
+         // function: popIoRing, __atomic_sub_fetch, addIoHeap
+      request = popIoRing( ioPool );
+
+      while( request != NULL )
+      {
+         __atomic_sub_fetch( &ioPool->queuedCount, 1, __ATOMIC_SEQ_CST );
+         addIoHeap( ioPool, request );
+
+         request = popIoRing( ioPool );
+      }
+
+      // check for a request whose device has finished
+         // function: getMonotonicNSec
+      if( ioPool->heapSize > 0
+          && ioPool->heapArray[ 0 ]->wakeNSec <= getMonotonicNSec() )
+      {
+         // report the request done, and wake the scheduler if it waits
+            // function: takeIoHeap, pushIoCompletion, pthread_cond_signal
+         request = takeIoHeap( ioPool );
+         pushIoCompletion( ioPool, request );
+         pthread_cond_signal( &ioPool->completionCondition );
+      }
+      // otherwise, sleep until the earliest finish time, or a new request
+      else
+      {
+         // function: __atomic_add_fetch, __atomic_load_n,
+         //           pthread_cond_timedwait, pthread_cond_wait,
+         //           __atomic_sub_fetch
+         __atomic_add_fetch( &ioPool->idleCount, 1, __ATOMIC_SEQ_CST );
+
+         if( __atomic_load_n( &ioPool->queuedCount, __ATOMIC_SEQ_CST ) <= 0 )
+         {
+            // check for a request to wait on
+            if( ioPool->heapSize > 0 )
+            {
+               wakeNSec = ioPool->heapArray[ 0 ]->wakeNSec;
+               wakeData.tv_sec = (time_t) ( wakeNSec / 1000000000 );
+               wakeData.tv_nsec = (long) ( wakeNSec % 1000000000 );
+
+               pthread_cond_timedwait( &ioPool->workCondition,
+                                          &ioPool->poolMutex, &wakeData );
+            }
+            // otherwise, wait for one
+            else
+            {
+               pthread_cond_wait( &ioPool->workCondition,
+                                                      &ioPool->poolMutex );
+            }
+         }
+
+         __atomic_sub_fetch( &ioPool->idleCount, 1, __ATOMIC_SEQ_CST );
+      }
+   }
+
+   // function: pthread_mutex_unlock
+   pthread_mutex_unlock( &ioPool->poolMutex );
+
+   return NULL;
+}
@@ -0,0 +1,27 @@
+// Pre-compiler directive
+#ifndef IO_MANAGEMENT_H
+#define IO_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include <pthread.h>
+#include "StringUtils.h"
+#include "simulator.h"
+
+// function prototypes
+void initIoPool( IoPool *ioPool );
+void startIoPool( IoPool *ioPool, int processCount );
+void stopIoPool( IoPool *ioPool );
+void submitIoRequest( IoPool *ioPool, SimTimer *timer, PCB *pcb );
+void drainIoCompletions( IoPool *ioPool );
+void awaitIoCompletion( IoPool *ioPool, PCB *pcb );
+Boolean pushIoRing( IoPool *ioPool, IoRequest *request );
+IoRequest *popIoRing( IoPool *ioPool );
+void pushIoCompletion( IoPool *ioPool, IoRequest *request );
+void addIoHeap( IoPool *ioPool, IoRequest *request );
+IoRequest *takeIoHeap( IoPool *ioPool );
+long long getMonotonicNSec();
+void *runIoWorker( void *ioPoolPtr );
+
+#endif   // IO_MANAGEMENT_H
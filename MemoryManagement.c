@@ -2,112 +2,263 @@
 #include "configops.h"
 #include "simulator.h"
 #include "MemoryManagement.h"
+#include "DisplayLog.h"
+#include "PageManagement.h"
 
 /*
-Funtion name: addMemoryNode
-Algorithm: adds MemoryBlock structure with data to a linked list
-Precondition: linked list pointer assigned to null or to one MemoryBlock link,
-              struct pointer assigned to MemoryBlock struct data
-Postcondiditon: assigns new structure node to beginning of linked list
-                or and of established linked list
+Funtion name: initMemory
+Algorithm: empties the block arrays and sets the whole configured memory
+           as one free region
+Precondition: config is set in the context
+Postcondiditon: no block is allocated
+Exceptions: none
+Note: none
+*/
+void initMemory( SimContext *simContext )
+{
+   // initialize variables
+   MemoryBlock freeNode;
+   int orderIndex = 0;
+   
+   simContext->memBlocks.blockArray = NULL;
+   simContext->memBlocks.blockCount = 0;
+   simContext->memBlocks.blockCapacity = 0;
+   
+   simContext->freeRegions.blockArray = NULL;
+   simContext->freeRegions.blockCount = 0;
+   simContext->freeRegions.blockCapacity = 0;
+   
+   // no placement yet
+   simContext->nextFitAddress = 0;
+   simContext->buddyLists.orderArray = NULL;
+   simContext->buddyLists.nextArray = NULL;
+   simContext->buddyLists.prevArray = NULL;
+   
+   while( orderIndex < BUDDY_ORDER_COUNT )
+   {
+      simContext->buddyLists.headArray[ orderIndex ] = -1;
+      
+      orderIndex++;
+   }
+   
+   simContext->placementReport.requestCount = 0;
+   simContext->placementReport.failCount = 0;
+   simContext->placementReport.searchSum = 0;
+   simContext->placementReport.searchMax = 0;
+   simContext->placementReport.externalSum = 0.0;
+   simContext->placementReport.externalMax = 0.0;
+   simContext->placementReport.askedSum = 0;
+   simContext->placementReport.placedSum = 0;
+   
+   // no page mapped, when memory is paged
+      // function: initPaging
+   initPaging( simContext );
+   
+   // the bounds are inclusive, as are the bounds of an allocation
+   freeNode.lowerBound = 0;
+   freeNode.upperBound = simContext->configPtr->memAvailable;
+   freeNode.designatedPCB = NULL;
+   
+   // function: insertMemoryBlock
+   insertMemoryBlock( &simContext->freeRegions, 0, &freeNode );
+}
+
+/*
+Funtion name: findMemoryBlock
+Algorithm: binary searches the array for the last block starting at or
+           below the address
+Precondition: array is in lower bound order
+Postcondiditon: returns the index of the block, or -1 if none starts at or
+                below the address
+Exceptions: none
+Note: the blocks never overlap, so the block found is the only one that
+      can hold the address
+*/
+int findMemoryBlock( BlockArray *blocks, int address )
+{
+   // initialize variables
+   int lowIndex = 0;
+   int highIndex = blocks->blockCount - 1;
+   int midIndex;
+   int foundIndex = -1;
+   
+   // loop until the range is empty
+   while( lowIndex <= highIndex )
+   {
+      midIndex = ( lowIndex + highIndex ) / 2;
+      
+      // check for a block starting at or below the address
+      if( blocks->blockArray[ midIndex ].lowerBound <= address )
+      {
+         // keep it, and look for a later one
+         foundIndex = midIndex;
+         lowIndex = midIndex + 1;
+      }
+      // otherwise, look below it
+      else
+      {
+         highIndex = midIndex - 1;
+      }
+   }
+   // end loop
+   
+   return foundIndex;
+}
+
+/*
+Funtion name: insertMemoryBlock
+Algorithm: shifts the blocks from the index up one place and copies the
+           new block in, doubling the array when it is full
+Precondition: the index keeps the array in lower bound order
+Postcondiditon: the block is in the array
 Exceptions: none
 Note: assumes memory access/availability
 */
-MemoryBlock *addMemoryNode( MemoryBlock *localPtr, MemoryBlock *newNode )
+void insertMemoryBlock( BlockArray *blocks, int blockIndex,
+                                                     MemoryBlock *newNode )
 {
-   // check for local pointer assigned to null
-   if( localPtr == NULL )
+   // initialize variables
+   int moveIndex = blocks->blockCount;
+   
+   // check for a full array
+   if( blocks->blockCount == blocks->blockCapacity )
    {
-      // access new memory for new link/node
-         // function: malloc
-      localPtr = (MemoryBlock *)malloc( sizeof( MemoryBlock ) );
-         
-      // assign all three values to newly created node
-      // assign next pointer to null
-      localPtr->upperBound = newNode->upperBound;
-      localPtr->lowerBound = newNode->lowerBound;
-      localPtr->designatedPCB = newNode->designatedPCB;
+      // double the capacity, starting at 64
+      blocks->blockCapacity = blocks->blockCapacity * 2;
       
-      localPtr->nextNode = NULL;
-         
-      // return current local pointer
-      return localPtr;
-   }  
-   // assume end of list is not found yet
-   // assign recursive function to current's next link
-      // function: addMemoryNodeNode
-   localPtr->nextNode = addMemoryNode( localPtr->nextNode, newNode );
+      if( blocks->blockCapacity == 0 )
+      {
+         blocks->blockCapacity = 64;
+      }
+      
+         // function: realloc
+      blocks->blockArray = (MemoryBlock *)realloc( blocks->blockArray,
+                              sizeof( MemoryBlock ) * blocks->blockCapacity );
+   }
+   
+   // loop down to the index, moving each block up one place
+   while( moveIndex > blockIndex )
+   {
+      blocks->blockArray[ moveIndex ] = blocks->blockArray[ moveIndex - 1 ];
       
-   // return local pointer   
-   return localPtr;
+      moveIndex--;
+   }
+   // end loop
+   
+   // copy the block in
+   blocks->blockArray[ blockIndex ].lowerBound = newNode->lowerBound;
+   blocks->blockArray[ blockIndex ].upperBound = newNode->upperBound;
+   blocks->blockArray[ blockIndex ].designatedPCB = newNode->designatedPCB;
+   
+   blocks->blockCount++;
+}
+
+/*
+Funtion name: removeMemoryBlock
+Algorithm: shifts the blocks above the index down one place
+Precondition: index is within the array
+Postcondiditon: the block is out of the array
+Exceptions: none
+Note: none
+*/
+void removeMemoryBlock( BlockArray *blocks, int blockIndex )
+{
+   // initialize variables
+   int moveIndex = blockIndex;
+   
+   blocks->blockCount--;
+   
+   // loop up to the end, moving each block down one place
+   while( moveIndex < blocks->blockCount )
+   {
+      blocks->blockArray[ moveIndex ] = blocks->blockArray[ moveIndex + 1 ];
+      
+      moveIndex++;
+   }
+   // end loop
 }
 
 /*
 Funtion name: allocateMem
-Algorithm: runs through the linked list of bounds to make sure
-           there is no overlapping of allocations
+Algorithm: finds the block starting last at or below the new upper bound;
+           the new block overlaps a block only if it overlaps that one,
+           otherwise it is inserted after it and taken from the free
+           regions; a block without a base is placed by the MMU
 Precondition: there are correct values for the memory
               block node
 Postcondiditon: return the state of whether a seg fault occured or not
 Exceptions: none
-Note: none
+Note: blocks sharing a bound overlap
 */
-Boolean allocateMem( MemoryBlock *newMemNode, MemoryBlock **memListHead, 
-                                                ConfigDataType *configDataPtr )
+Boolean allocateMem( SimContext *simContext, MemoryBlock *newMemNode )
 {
    // initialize variables
-   MemoryBlock *localPtr = NULL;
+   ConfigDataType *configDataPtr = simContext->configPtr;
+   BlockArray *memBlocks = &simContext->memBlocks;
    Boolean segFault = False;
+   int blockIndex;
    
-   // initialize local pointer to list head
-   localPtr = *memListHead;
+   // check for a block the MMU places
+   if( newMemNode->lowerBound == MEM_PLACED_BASE )
+   {
+      // function: placeMem
+      segFault = placeMem( simContext, newMemNode );
+   }
    
-   // check if the upper bound exceeds the configured memory limits
-   if( newMemNode->upperBound > configDataPtr->memAvailable
+   // otherwise, check if the upper bound exceeds the configured memory
+   //    limits
+   else if( newMemNode->upperBound > configDataPtr->memAvailable
        || newMemNode->lowerBound < 0 )
    {
       // if so, that is a seg fault
       segFault = True;
    }
    
-   // check if the local pointer is null
-   else if( localPtr == NULL )
-   {
-      // set list head to the first memory block created
-         // function: addMemoryNode
-      *memListHead = addMemoryNode( localPtr, newMemNode );
-   }
-   
-   // otherwise assume that there are already mem allocs
+   // otherwise, check against the allocated blocks
    else
    {
-      // loop through all memory blocks
-      while( localPtr != NULL && segFault == False )
-      {
-         // check if the bounds of the new node do not overlap local pointer
-         //    also check if said pcb that allocated memory is in running state
-         //    or blocked state
-         if( !( ( newMemNode->upperBound > localPtr->upperBound && 
-               newMemNode->lowerBound > localPtr->upperBound ) ||
-             ( newMemNode->upperBound < localPtr->lowerBound && 
-               newMemNode->lowerBound < localPtr->lowerBound ) ) &&
-             ( compareString( localPtr->designatedPCB->processState, "EXIT") != STR_EQ ) )
+      // find the block starting last at or below the new upper bound
+         // function: findMemoryBlock
+      blockIndex = findMemoryBlock( memBlocks, newMemNode->upperBound );
+      
+      // check if it reaches the new lower bound
+      if( blockIndex >= 0 && memBlocks->blockArray[ blockIndex ].upperBound
+                                                  >= newMemNode->lowerBound )
+      {
+         // if so, that is a seg fault
+         segFault = True;
+      }
+      // otherwise, check for paged memory without the frames for it
+         // function: hasFreeFrames
+      else if( configDataPtr->pageSize > 0
+               && hasFreeFrames( simContext, newMemNode->designatedPCB,
+                 newMemNode->lowerBound, newMemNode->upperBound ) == False )
+      {
+         // that is a seg fault as well
+         segFault = True;
+      }
+      // otherwise, add the block after it
+      else
+      {
+         // function: insertMemoryBlock, takeFreeRegion
+         insertMemoryBlock( memBlocks, blockIndex + 1, newMemNode );
+         takeFreeRegion( simContext, newMemNode );
+         
+         // check for buddy lists to keep in step
+         if( simContext->buddyLists.orderArray != NULL )
          {
-            // if so, that is a seg fault
-            segFault = True;
+            // function: reserveBuddyRange
+            reserveBuddyRange( simContext, newMemNode->lowerBound,
+                                                  newMemNode->upperBound );
          }
          
-         // iterate to the next memory block
-         localPtr = localPtr->nextNode;
-      }
-      // end loop
-      
-      // check if there was no seg fault detected
-      if( segFault == False )
-      {
-         // if not, add the memory block to the linked list
-            // function: addMemoryNode
-         localPtr = addMemoryNode( *memListHead, newMemNode );
+         // check for paged memory
+         if( configDataPtr->pageSize > 0 )
+         {
+            // function: mapPages
+            mapPages( simContext, newMemNode->designatedPCB,
+                          newMemNode->lowerBound, newMemNode->upperBound );
+         }
       }
    }
    
@@ -116,23 +267,23 @@ Boolean allocateMem( MemoryBlock *newMemNode, MemoryBlock **memListHead,
 
 /*
 Funtion name: accessMem
-Algorithm: runs through the linked list of bounds to make sure
-           there is proper allocated memory
+Algorithm: finds the block starting last at or below the access, the only
+           one that can hold it, and checks its upper bound and owner
 Precondition: there are correct values for the memory
               block node
 Postcondiditon: return the state of whether a seg fault occured or not
-Exceptions: none
+Exceptions: with resident frames set, an access over more pages than the
+            frames is a seg fault
 Note: none
 */
-Boolean accessMem( int lowerBound, int upperBound, MemoryBlock *memListHead,
-                                ConfigDataType *configDataPtr, int pidOfAccess )
+Boolean accessMem( SimContext *simContext, int lowerBound, 
+                                             int upperBound, int pidOfAccess )
 {
    // initialize variables
+   ConfigDataType *configDataPtr = simContext->configPtr;
+   BlockArray *memBlocks = &simContext->memBlocks;
    Boolean segFault = False;
-   MemoryBlock *localPtr = NULL;
-   
-   // set the local pointer to the list head
-   localPtr = memListHead;
+   int blockIndex;
    
    // check if the allocation is beyond limits
    if( lowerBound < 0 || upperBound > configDataPtr->memAvailable )
@@ -147,54 +298,859 @@ Boolean accessMem( int lowerBound, int upperBound, MemoryBlock *memListHead,
       // unless specified otherwise, there is a seg fault
       segFault = True;
       
-      // loop through memory blocks
-      while( localPtr != NULL && segFault == True )
+      // find the block starting last at or below the access
+         // function: findMemoryBlock
+      blockIndex = findMemoryBlock( memBlocks, lowerBound );
+      
+      // check if the access is within its limits and it is the process's
+      if( blockIndex >= 0
+          && upperBound <= memBlocks->blockArray[ blockIndex ].upperBound
+          && memBlocks->blockArray[ blockIndex ].designatedPCB->pid
+                                                            == pidOfAccess )
       {
-         // check if the access is within allocation limits
-         if( upperBound <= localPtr->upperBound &&
-         lowerBound >= localPtr->lowerBound &&
-         compareString( localPtr->designatedPCB->processState, "EXIT" ) != STR_EQ &&
-         localPtr->designatedPCB->pid == pidOfAccess )
+         // if so, there available allocated memory
+         segFault = False;
+      }
+      
+      // check for more pages than resident frames, which can never be
+      //    in memory at once
+      if( configDataPtr->residentFrameCount > 0
+          && configDataPtr->pageSize > 0
+          && upperBound / configDataPtr->pageSize
+             - lowerBound / configDataPtr->pageSize
+                                     >= configDataPtr->residentFrameCount )
+      {
+         // that is a seg fault as well
+         segFault = True;
+      }
+   }
+   
+   return segFault;
+}
+
+/*
+Funtion name: releaseMemory
+Algorithm: packs the blocks of other processes down over the blocks of
+           the given process, returning each of its blocks to the free
+           regions
+Precondition: process is moving to EXIT
+Postcondiditon: no block belongs to the process
+Exceptions: none
+Note: a single pass over the allocated blocks
+*/
+void releaseMemory( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   BlockArray *memBlocks = &simContext->memBlocks;
+   int readIndex = 0;
+   int writeIndex = 0;
+   
+   // loop across the allocated blocks
+   while( readIndex < memBlocks->blockCount )
+   {
+      // check for a block of the process
+      if( memBlocks->blockArray[ readIndex ].designatedPCB == pcb )
+      {
+         // function: returnFreeRegion
+         returnFreeRegion( simContext,
+                                    &memBlocks->blockArray[ readIndex ] );
+         
+         // check for buddy lists to keep in step
+         if( simContext->buddyLists.orderArray != NULL )
          {
-            // if so, there available allocated memory
-            segFault = False;
+            // function: freeBuddyRange
+            freeBuddyRange( simContext,
+                           memBlocks->blockArray[ readIndex ].lowerBound,
+                           memBlocks->blockArray[ readIndex ].upperBound );
          }
+      }
+      // otherwise, keep it
+      else
+      {
+         memBlocks->blockArray[ writeIndex ] =
+                                      memBlocks->blockArray[ readIndex ];
          
-         // iterate to the next memory block
-         localPtr = localPtr->nextNode;
+         writeIndex++;
       }
+      
+      readIndex++;
    }
+   // end loop
    
-   return segFault;
+   memBlocks->blockCount = writeIndex;
+   
+   // check for pages mapped by the process
+   if( pcb->pageTable != NULL )
+   {
+      // function: unmapPages
+      unmapPages( simContext, pcb );
+   }
+}
+
+/*
+Funtion name: takeFreeRegion
+Algorithm: finds the free region holding the new block and cuts the block
+           out of it, keeping the parts left below and above it
+Precondition: the block overlaps no allocated block
+Postcondiditon: the block's addresses are out of the free regions
+Exceptions: none
+Note: the free regions are the addresses no block holds, so one free
+      region holds the whole block
+*/
+void takeFreeRegion( SimContext *simContext, MemoryBlock *newNode )
+{
+   // initialize variables
+   BlockArray *freeRegions = &simContext->freeRegions;
+   int regionIndex;
+   MemoryBlock *region;
+   MemoryBlock aboveNode;
+   
+   // find the region starting last at or below the block
+      // function: findMemoryBlock
+   regionIndex = findMemoryBlock( freeRegions, newNode->lowerBound );
+   region = &freeRegions->blockArray[ regionIndex ];
+   
+   // keep the part above the block
+   aboveNode.lowerBound = newNode->upperBound + 1;
+   aboveNode.upperBound = region->upperBound;
+   aboveNode.designatedPCB = NULL;
+   
+   // check for a part below the block
+   if( region->lowerBound < newNode->lowerBound )
+   {
+      region->upperBound = newNode->lowerBound - 1;
+      
+      // check for a part above the block as well
+      if( aboveNode.lowerBound <= aboveNode.upperBound )
+      {
+         // function: insertMemoryBlock
+         insertMemoryBlock( freeRegions, regionIndex + 1, &aboveNode );
+      }
+   }
+   // otherwise, check for a part above the block only
+   else if( aboveNode.lowerBound <= aboveNode.upperBound )
+   {
+      region->lowerBound = aboveNode.lowerBound;
+   }
+   // otherwise, the block took the whole region
+   else
+   {
+      // function: removeMemoryBlock
+      removeMemoryBlock( freeRegions, regionIndex );
+   }
 }
 
 /*
-Funtion name: clearMemoryList
-Algorithm: recursively iterates through memory linked list
-           returns memory to OS from the bottom of the list upward
-Precondition: clinked list, with or without data
-Postcondiditon: all node memory, if any, is returned to OS,
-                return pointer (head) is set to null
+Funtion name: returnFreeRegion
+Algorithm: adds the addresses of a released block to the free regions,
+           joining it to the region ending right below it and the region
+           starting right above it
+Precondition: the block's addresses are out of the free regions
+Postcondiditon: no two free regions touch
 Exceptions: none
 Note: none
 */
-MemoryBlock *clearMemoryList( MemoryBlock *localPtr )
+void returnFreeRegion( SimContext *simContext, MemoryBlock *oldNode )
 {
-   // check for localPtr not set to null ( list isnt empty )
-   if( localPtr != NULL )
+   // initialize variables
+   BlockArray *freeRegions = &simContext->freeRegions;
+   MemoryBlock *regionArray = freeRegions->blockArray;
+   int belowIndex;
+   Boolean joinBelow = False;
+   Boolean joinAbove = False;
+   MemoryBlock freeNode;
+   
+   // find the region below the block
+      // function: findMemoryBlock
+   belowIndex = findMemoryBlock( freeRegions, oldNode->lowerBound );
+   
+   // check for the region below ending right below the block
+   if( belowIndex >= 0
+             && regionArray[ belowIndex ].upperBound == oldNode->lowerBound - 1 )
    {
-      // call for recursive function with next pointer
-         // function: clearMetaDataList
-      clearMemoryList( localPtr->nextNode );
+      joinBelow = True;
+   }
+   
+   // check for the region above starting right above the block
+   if( belowIndex + 1 < freeRegions->blockCount
+       && regionArray[ belowIndex + 1 ].lowerBound == oldNode->upperBound + 1 )
+   {
+      joinAbove = True;
+   }
+   
+   // check for regions on both sides, they become one
+   if( joinBelow == True && joinAbove == True )
+   {
+      regionArray[ belowIndex ].upperBound =
+                                    regionArray[ belowIndex + 1 ].upperBound;
       
-      // after recursive call, release memory to OS
-         // function: free
-      free( localPtr );
+      // function: removeMemoryBlock
+      removeMemoryBlock( freeRegions, belowIndex + 1 );
+   }
+   // otherwise, check for the region below only
+   else if( joinBelow == True )
+   {
+      regionArray[ belowIndex ].upperBound = oldNode->upperBound;
+   }
+   // otherwise, check for the region above only
+   else if( joinAbove == True )
+   {
+      regionArray[ belowIndex + 1 ].lowerBound = oldNode->lowerBound;
+   }
+   // otherwise, the block is a new region
+   else
+   {
+      freeNode.lowerBound = oldNode->lowerBound;
+      freeNode.upperBound = oldNode->upperBound;
+      freeNode.designatedPCB = NULL;
+      
+      // function: insertMemoryBlock
+      insertMemoryBlock( freeRegions, belowIndex + 1, &freeNode );
+   }
+}
+
+/*
+Funtion name: clearMemoryBlocks
+Algorithm: returns the block arrays, buddy lists and paging memory to the
+           OS
+Precondition: block arrays, with or without data
+Postcondiditon: array memory, if any, is returned to OS, the arrays are
+                empty
+Exceptions: none
+Note: none
+*/
+void clearMemoryBlocks( SimContext *simContext )
+{
+   // function: free
+   free( simContext->memBlocks.blockArray );
+   free( simContext->freeRegions.blockArray );
+   free( simContext->buddyLists.orderArray );
+   free( simContext->buddyLists.nextArray );
+   free( simContext->buddyLists.prevArray );
+   
+      // function: clearPaging
+   clearPaging( simContext );
+   
+   simContext->buddyLists.orderArray = NULL;
+   simContext->buddyLists.nextArray = NULL;
+   simContext->buddyLists.prevArray = NULL;
+   
+   simContext->memBlocks.blockArray = NULL;
+   simContext->memBlocks.blockCount = 0;
+   simContext->memBlocks.blockCapacity = 0;
+   
+   simContext->freeRegions.blockArray = NULL;
+   simContext->freeRegions.blockCount = 0;
+   simContext->freeRegions.blockCapacity = 0;
+}
+
+/*
+Funtion name: placeMem
+Algorithm: places a block of the asked size with the configured policy,
+           takes it from the free regions and records the search and the
+           fragmentation the request met
+Precondition: block node with MEM_PLACED_BASE as its lower bound and the
+              asked size less one as its upper bound
+Postcondiditon: on success the node and its process hold the placed
+                bounds; returns whether the request failed
+Exceptions: a request no free region can hold fails as a seg fault
+Note: a placed block holds the asked size plus one addresses, as a fixed
+      block of that size does; buddy placement holds the whole power of
+      two block
+*/
+Boolean placeMem( SimContext *simContext, MemoryBlock *newMemNode )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   PlacementReport *placementReport = &simContext->placementReport;
+   int sizeNeeded = newMemNode->upperBound - newMemNode->lowerBound + 1;
+   int placedSize = sizeNeeded;
+   int searchCount = 0;
+   int placedBase = -1;
+   int blockIndex;
+   
+   // sample the fragmentation the request meets
+      // function: sampleFragmentation
+   sampleFragmentation( simContext );
+   
+   placementReport->requestCount++;
+   
+   // check for a size the memory can hold at all
+   if( sizeNeeded <= configPtr->memAvailable + 1 )
+   {
+      // check for buddy placement
+      if( configPtr->memPlacementCode == PLACE_BUDDY_CODE )
+      {
+         // function: placeBuddy
+         placedBase = placeBuddy( simContext, sizeNeeded, &placedSize,
+                                                             &searchCount );
+      }
+      
+      // otherwise, search the free regions
+      else
+      {
+         // function: placeFit
+         placedBase = placeFit( simContext, sizeNeeded, &searchCount );
+      }
+   }
+   
+   placementReport->searchSum = placementReport->searchSum + searchCount;
+   
+   if( searchCount > placementReport->searchMax )
+   {
+      placementReport->searchMax = searchCount;
+   }
+   
+   // check for paged memory without the frames for the placement
+      // function: hasFreeFrames
+   if( placedBase >= 0 && configPtr->pageSize > 0
+        && hasFreeFrames( simContext, newMemNode->designatedPCB, placedBase,
+                                   placedBase + placedSize - 1 ) == False )
+   {
+      // a buddy block goes back to its lists
+      if( configPtr->memPlacementCode == PLACE_BUDDY_CODE )
+      {
+         // function: freeBuddyRange
+         freeBuddyRange( simContext, placedBase,
+                                            placedBase + placedSize - 1 );
+      }
+      
+      placedBase = -1;
+   }
+   
+   // check for no room
+   if( placedBase < 0 )
+   {
+      placementReport->failCount++;
+      
+      return True;
+   }
+   
+   placementReport->askedSum = placementReport->askedSum + sizeNeeded;
+   placementReport->placedSum = placementReport->placedSum + placedSize;
+   
+   newMemNode->lowerBound = placedBase;
+   newMemNode->upperBound = placedBase + placedSize - 1;
+   newMemNode->designatedPCB->placedBase = placedBase;
+   
+   // the placed range is free, so it goes after the block below it
+      // function: findMemoryBlock, insertMemoryBlock, takeFreeRegion
+   blockIndex = findMemoryBlock( &simContext->memBlocks, placedBase );
+   insertMemoryBlock( &simContext->memBlocks, blockIndex + 1, newMemNode );
+   takeFreeRegion( simContext, newMemNode );
+   
+   // check for paged memory
+   if( configPtr->pageSize > 0 )
+   {
+      // function: mapPages
+      mapPages( simContext, newMemNode->designatedPCB,
+                          newMemNode->lowerBound, newMemNode->upperBound );
+   }
+   
+   return False;
+}
+
+/*
+Funtion name: placeFit
+Algorithm: scans the free regions in address order for one that holds the
+           size; first fit takes the first one, next fit the first one
+           from where the last placement ended, wrapping around, and best
+           fit the smallest one, the lowest on a tie
+Precondition: size in addresses, at least one
+Postcondiditon: returns the base of the placement, the start of the chosen
+                region, or -1 if none holds it; the regions looked at are
+                added to the search count
+Exceptions: none
+Note: next fit moves on to the end of the placement
+*/
+int placeFit( SimContext *simContext, int sizeNeeded, int *searchCount )
+{
+   // initialize variables
+   BlockArray *freeRegions = &simContext->freeRegions;
+   MemoryBlock *regionArray = freeRegions->blockArray;
+   int placementCode = simContext->configPtr->memPlacementCode;
+   int regionIndex = 0;
+   int foundIndex = -1;
+   int foundSize = 0;
+   int visitCount = 0;
+   int regionSize;
+   Boolean searchFlag = True;
+   
+   // check for next fit
+   if( placementCode == PLACE_NEXT_FIT_CODE )
+   {
+      // start at the region holding or following the last placement end
+         // function: findMemoryBlock
+      regionIndex = findMemoryBlock( freeRegions,
+                                              simContext->nextFitAddress );
       
-      // set local pointer to null
-      localPtr = NULL;
-   }   
-   // return null to calling function
+      if( regionIndex < 0 )
+      {
+         regionIndex = 0;
+      }
+      
+      else if( regionArray[ regionIndex ].upperBound
+                                             < simContext->nextFitAddress )
+      {
+         regionIndex++;
+      }
+      
+      if( regionIndex >= freeRegions->blockCount )
+      {
+         regionIndex = 0;
+      }
+   }
+   
+   // loop across the regions once
+   while( searchFlag == True && visitCount < freeRegions->blockCount )
+   {
+      regionSize = regionArray[ regionIndex ].upperBound
+                                  - regionArray[ regionIndex ].lowerBound + 1;
+      
+      visitCount++;
+      
+      // check for a region that holds the size and beats the one found
+      if( regionSize >= sizeNeeded
+                               && ( foundIndex < 0 || regionSize < foundSize ) )
+      {
+         foundIndex = regionIndex;
+         foundSize = regionSize;
+         
+         // only best fit looks further, and not past an exact fit
+         if( placementCode != PLACE_BEST_FIT_CODE || regionSize == sizeNeeded )
+         {
+            searchFlag = False;
+         }
+      }
+      
+      regionIndex++;
+      
+      if( regionIndex >= freeRegions->blockCount )
+      {
+         regionIndex = 0;
+      }
+   }
+   
+   *searchCount = *searchCount + visitCount;
+   
+   // check for no region found
+   if( foundIndex < 0 )
+   {
+      return -1;
+   }
+   
+   simContext->nextFitAddress = regionArray[ foundIndex ].lowerBound
+                                                               + sizeNeeded;
+   
+   return regionArray[ foundIndex ].lowerBound;
+}
+
+/*
+Funtion name: placeBuddy
+Algorithm: takes the head of the smallest nonempty order at or above the
+           order of the size, splitting it in halves down to that order
+           and freeing the upper halves
+Precondition: size in addresses, at most the memory size plus one
+Postcondiditon: returns the base of the block, or -1 if no order holds
+                it; the block size is set and the orders looked at and the
+                splits are added to the search count
+Exceptions: none
+Note: the lists are built from the free regions at the first buddy
+      placement
+*/
+int placeBuddy( SimContext *simContext, int sizeNeeded, int *placedSize,
+                                                         int *searchCount )
+{
+   // initialize variables
+   BuddyLists *buddyLists = &simContext->buddyLists;
+   int neededOrder = 0;
+   int orderIndex;
+   int blockAddress;
+   
+   // check for lists not built yet
+   if( buddyLists->orderArray == NULL )
+   {
+      // function: buildBuddyLists
+      buildBuddyLists( simContext );
+   }
+   
+   // find the order of the size
+   while( ( 1 << neededOrder ) < sizeNeeded )
+   {
+      neededOrder++;
+   }
+   
+   // find the smallest order with a free block
+   orderIndex = neededOrder;
+   
+   while( orderIndex < BUDDY_ORDER_COUNT
+                               && buddyLists->headArray[ orderIndex ] < 0 )
+   {
+      orderIndex++;
+   }
+   
+   *searchCount = *searchCount + orderIndex - neededOrder + 1;
+   
+   // check for no block large enough
+   if( orderIndex >= BUDDY_ORDER_COUNT )
+   {
+      return -1;
+   }
+   
+   blockAddress = buddyLists->headArray[ orderIndex ];
+   
+      // function: unlinkBuddy
+   unlinkBuddy( buddyLists, blockAddress );
+   
+   // split down to the order of the size, keeping the lower half
+   while( orderIndex > neededOrder )
+   {
+      orderIndex--;
+      
+         // function: pushBuddy
+      pushBuddy( buddyLists, blockAddress + ( 1 << orderIndex ),
+                                                                orderIndex );
+      
+      *searchCount = *searchCount + 1;
+   }
+   
+   *placedSize = 1 << neededOrder;
+   
+   return blockAddress;
+}
+
+/*
+Funtion name: buildBuddyLists
+Algorithm: sets up the per address arrays with no free blocks and frees
+           each free region into them
+Precondition: free regions in address order
+Postcondiditon: lists hold the free regions as merged buddy blocks
+Exceptions: none
+Note: addresses run from 0 to the memory size
+*/
+void buildBuddyLists( SimContext *simContext )
+{
+   // initialize variables
+   BuddyLists *buddyLists = &simContext->buddyLists;
+   int addressCount = simContext->configPtr->memAvailable + 1;
+   int addressIndex = 0;
+   int regionIndex = 0;
+   
+   // function: malloc
+   buddyLists->orderArray = (int *)malloc( addressCount * sizeof( int ) );
+   buddyLists->nextArray = (int *)malloc( addressCount * sizeof( int ) );
+   buddyLists->prevArray = (int *)malloc( addressCount * sizeof( int ) );
+   
+   // no address starts a free block yet
+   while( addressIndex < addressCount )
+   {
+      buddyLists->orderArray[ addressIndex ] = -1;
+      
+      addressIndex++;
+   }
+   
+   // loop across the free regions
+   while( regionIndex < simContext->freeRegions.blockCount )
+   {
+      // function: freeBuddyRange
+      freeBuddyRange( simContext,
+              simContext->freeRegions.blockArray[ regionIndex ].lowerBound,
+              simContext->freeRegions.blockArray[ regionIndex ].upperBound );
+      
+      regionIndex++;
+   }
+}
+
+/*
+Funtion name: freeBuddyRange
+Algorithm: frees the range as the largest aligned blocks that fit in it,
+           each merged with its free buddies
+Precondition: range with no part in the lists
+Postcondiditon: range is free in the lists
+Exceptions: none
+Note: bounds are inclusive
+*/
+void freeBuddyRange( SimContext *simContext, int lowerBound,
+                                                           int upperBound )
+{
+   // initialize variables
+   int blockAddress = lowerBound;
+   int blockOrder;
+   
+   // loop across the range
+   while( blockAddress <= upperBound )
+   {
+      // grow the block while it stays aligned and inside the range
+      blockOrder = 0;
+      
+      while( blockOrder + 1 < BUDDY_ORDER_COUNT
+                         && blockAddress % ( 2 << blockOrder ) == 0
+                         && blockAddress + ( 2 << blockOrder ) - 1 <= upperBound )
+      {
+         blockOrder++;
+      }
+      
+      // function: freeBuddyBlock
+      freeBuddyBlock( simContext, blockAddress, blockOrder );
+      
+      blockAddress = blockAddress + ( 1 << blockOrder );
+   }
+}
+
+/*
+Funtion name: freeBuddyBlock
+Algorithm: merges the block with its buddy while the buddy is a free
+           block of the same order, then adds the merged block to its list
+Precondition: aligned block with no part in the lists
+Postcondiditon: block is free in the lists
+Exceptions: none
+Note: the buddy address differs from the block in the order bit only
+*/
+void freeBuddyBlock( SimContext *simContext, int blockAddress,
+                                                           int blockOrder )
+{
+   // initialize variables
+   BuddyLists *buddyLists = &simContext->buddyLists;
+   int memAvailable = simContext->configPtr->memAvailable;
+   int buddyAddress;
+   Boolean mergeFlag = True;
+   
+   // loop while the buddy is free
+   while( mergeFlag == True )
+   {
+      buddyAddress = blockAddress ^ ( 1 << blockOrder );
+      
+      // check for a free buddy of the same order
+      if( blockOrder + 1 < BUDDY_ORDER_COUNT && buddyAddress <= memAvailable
+                  && buddyLists->orderArray[ buddyAddress ] == blockOrder )
+      {
+         // function: unlinkBuddy
+         unlinkBuddy( buddyLists, buddyAddress );
+         
+         if( buddyAddress < blockAddress )
+         {
+            blockAddress = buddyAddress;
+         }
+         
+         blockOrder++;
+      }
+      
+      else
+      {
+         mergeFlag = False;
+      }
+   }
+   
+   // function: pushBuddy
+   pushBuddy( buddyLists, blockAddress, blockOrder );
+}
+
+/*
+Funtion name: reserveBuddyRange
+Algorithm: for each part of the range, splits the free block holding it
+           until the half holding it lies inside the range, then takes
+           that half out of the lists
+Precondition: range is free in the lists
+Postcondiditon: no part of the range is in the lists
+Exceptions: none
+Note: keeps the lists in step with fixed allocations
+*/
+void reserveBuddyRange( SimContext *simContext, int lowerBound,
+                                                           int upperBound )
+{
+   // initialize variables
+   BuddyLists *buddyLists = &simContext->buddyLists;
+   int partAddress = lowerBound;
+   int blockAddress;
+   int blockOrder;
+   
+   // loop across the range
+   while( partAddress <= upperBound )
+   {
+      // find the free block holding the address
+      blockOrder = 0;
+      blockAddress = partAddress;
+      
+      while( buddyLists->orderArray[ blockAddress ] != blockOrder )
+      {
+         blockOrder++;
+         blockAddress = partAddress & ~( ( 1 << blockOrder ) - 1 );
+      }
+      
+      // split it until the half holding the address is inside the range
+      while( blockAddress < partAddress
+                     || blockAddress + ( 1 << blockOrder ) - 1 > upperBound )
+      {
+            // function: unlinkBuddy, pushBuddy
+         unlinkBuddy( buddyLists, blockAddress );
+         
+         blockOrder--;
+         
+         pushBuddy( buddyLists, blockAddress, blockOrder );
+         pushBuddy( buddyLists, blockAddress + ( 1 << blockOrder ),
+                                                                blockOrder );
+         
+         if( partAddress >= blockAddress + ( 1 << blockOrder ) )
+         {
+            blockAddress = blockAddress + ( 1 << blockOrder );
+         }
+      }
+      
+         // function: unlinkBuddy
+      unlinkBuddy( buddyLists, blockAddress );
+      
+      partAddress = blockAddress + ( 1 << blockOrder );
+   }
+}
+
+/*
+Funtion name: pushBuddy
+Algorithm: adds the block at the head of the list of its order
+Precondition: aligned block not in the lists
+Postcondiditon: block is free at the given order
+Exceptions: none
+Note: none
+*/
+void pushBuddy( BuddyLists *buddyLists, int blockAddress, int blockOrder )
+{
+   // initialize variables
+   int headAddress = buddyLists->headArray[ blockOrder ];
+   
+   buddyLists->orderArray[ blockAddress ] = blockOrder;
+   buddyLists->prevArray[ blockAddress ] = -1;
+   buddyLists->nextArray[ blockAddress ] = headAddress;
+   
+   if( headAddress >= 0 )
+   {
+      buddyLists->prevArray[ headAddress ] = blockAddress;
+   }
+   
+   buddyLists->headArray[ blockOrder ] = blockAddress;
+}
+
+/*
+Funtion name: unlinkBuddy
+Algorithm: takes the block out of the list of its order
+Precondition: block is free in the lists
+Postcondiditon: block is no longer free
+Exceptions: none
+Note: none
+*/
+void unlinkBuddy( BuddyLists *buddyLists, int blockAddress )
+{
+   // initialize variables
+   int blockOrder = buddyLists->orderArray[ blockAddress ];
+   int prevAddress = buddyLists->prevArray[ blockAddress ];
+   int nextAddress = buddyLists->nextArray[ blockAddress ];
+   
+   if( prevAddress >= 0 )
+   {
+      buddyLists->nextArray[ prevAddress ] = nextAddress;
+   }
+   
+   else
+   {
+      buddyLists->headArray[ blockOrder ] = nextAddress;
+   }
+   
+   if( nextAddress >= 0 )
+   {
+      buddyLists->prevArray[ nextAddress ] = prevAddress;
+   }
+   
+   buddyLists->orderArray[ blockAddress ] = -1;
+}
+
+/*
+Funtion name: sampleFragmentation
+Algorithm: finds the free total and the largest free region and adds the
+           share of free memory outside the largest region to the report
+Precondition: free regions in address order
+Postcondiditon: external fragmentation sample is recorded
+Exceptions: no free memory counts as no fragmentation
+Note: none
+*/
+void sampleFragmentation( SimContext *simContext )
+{
+   // initialize variables
+   PlacementReport *placementReport = &simContext->placementReport;
+   MemoryBlock *regionArray = simContext->freeRegions.blockArray;
+   int regionIndex = 0;
+   int regionSize;
+   int largestSize = 0;
+   long long freeSum = 0;
+   double externalPercent = 0.0;
+   
+   // loop across the free regions
+   while( regionIndex < simContext->freeRegions.blockCount )
+   {
+      regionSize = regionArray[ regionIndex ].upperBound
+                                  - regionArray[ regionIndex ].lowerBound + 1;
+      
+      freeSum = freeSum + regionSize;
+      
+      if( regionSize > largestSize )
+      {
+         largestSize = regionSize;
+      }
+      
+      regionIndex++;
+   }
+   
+   if( freeSum > 0 )
+   {
+      externalPercent = (double)( freeSum - largestSize ) * 100 / freeSum;
+   }
+   
+   placementReport->externalSum = placementReport->externalSum
+                                                          + externalPercent;
+   
+   if( externalPercent > placementReport->externalMax )
+   {
+      placementReport->externalMax = externalPercent;
+   }
+}
+
+/*
+Funtion name: reportPlacement
+Algorithm: sets the failure share, the mean search, the mean external
+           fragmentation and the internal fragmentation of the placed
+           requests and logs them
+Precondition: every process is in EXIT
+Postcondiditon: placement summary is set and logged
+Exceptions: a run without placed requests is not logged
+Note: internal fragmentation is the share of the placed addresses beyond
+      the asked sizes
+*/
+void reportPlacement( SimContext *simContext )
+{
+   // initialize variables
+   PlacementReport *placementReport = &simContext->placementReport;
+   
+   // check for no placed requests
+   if( placementReport->requestCount == 0 )
+   {
+      return;
+   }
+   
+   placementReport->failPercent = (double)placementReport->failCount * 100
+                                            / placementReport->requestCount;
+   placementReport->meanSearch = (double)placementReport->searchSum
+                                            / placementReport->requestCount;
+   placementReport->meanExternal = placementReport->externalSum
+                                            / placementReport->requestCount;
+   placementReport->internalPercent = 0.0;
+   
+   if( placementReport->placedSum > 0 )
+   {
+      placementReport->internalPercent = (double)( placementReport->placedSum
+                                            - placementReport->askedSum ) * 100
+                                            / placementReport->placedSum;
+   }
    
-   return NULL;
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, PLACEMENT_REPORT, NONE );
+   displayAndLog( simContext, NULL, PLACEMENT_SEARCH_REPORT, NONE );
+   displayAndLog( simContext, NULL, FRAGMENTATION_REPORT, NONE );
 }
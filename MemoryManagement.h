@@ -20,16 +20,42 @@ typedef struct MemoryBlock
    
    // pointer to which pcb allocated memory
    struct PCB *designatedPCB;
-   
-   // pointer to the next PCB process
-   struct MemoryBlock *nextNode;
 } MemoryBlock;
 
+// simulation context, block array and buddy lists, defined in simulator.h
+struct SimContext;
+struct BlockArray;
+struct BuddyLists;
+
 // function prototypes
-Boolean allocateMem( MemoryBlock *newMemNode, MemoryBlock **memListHead, 
-                                                ConfigDataType *configDataPtr );
-Boolean accessMem( int lowerBound, int upperBound, MemoryBlock *memListHead,
-                                 ConfigDataType *configDataPtr, int pidOfAccess );
-MemoryBlock *clearMemoryList( MemoryBlock *localPtr );
+void initMemory( struct SimContext *simContext );
+int findMemoryBlock( struct BlockArray *blocks, int address );
+void insertMemoryBlock( struct BlockArray *blocks, int blockIndex,
+                                                     MemoryBlock *newNode );
+void removeMemoryBlock( struct BlockArray *blocks, int blockIndex );
+Boolean allocateMem( struct SimContext *simContext, MemoryBlock *newMemNode );
+Boolean accessMem( struct SimContext *simContext, int lowerBound, 
+                                             int upperBound, int pidOfAccess );
+void releaseMemory( struct SimContext *simContext, struct PCB *pcb );
+void takeFreeRegion( struct SimContext *simContext, MemoryBlock *newNode );
+void returnFreeRegion( struct SimContext *simContext, MemoryBlock *oldNode );
+void clearMemoryBlocks( struct SimContext *simContext );
+Boolean placeMem( struct SimContext *simContext, MemoryBlock *newMemNode );
+int placeFit( struct SimContext *simContext, int sizeNeeded,
+                                                         int *searchCount );
+int placeBuddy( struct SimContext *simContext, int sizeNeeded,
+                                       int *placedSize, int *searchCount );
+void buildBuddyLists( struct SimContext *simContext );
+void freeBuddyRange( struct SimContext *simContext, int lowerBound,
+                                                           int upperBound );
+void freeBuddyBlock( struct SimContext *simContext, int blockAddress,
+                                                           int blockOrder );
+void reserveBuddyRange( struct SimContext *simContext, int lowerBound,
+                                                           int upperBound );
+void pushBuddy( struct BuddyLists *buddyLists, int blockAddress,
+                                                           int blockOrder );
+void unlinkBuddy( struct BuddyLists *buddyLists, int blockAddress );
+void sampleFragmentation( struct SimContext *simContext );
+void reportPlacement( struct SimContext *simContext );
 
 #endif   // MEMORY_MANAGEMENT_H
@@ -4,6 +4,8 @@
 #include "simulator.h"
 #include "StringUtils.h"
 #include "DisplayLog.h"
+#include "simtimer.h"
+#include "BatchManagement.h"
 
 int main( int argc, char **argv )
 {
@@ -16,13 +18,19 @@ int main( int argc, char **argv )
       Boolean runSimFlag = False;
       Boolean infoFlag = False;
       Boolean mdDisplayFlag = False;
+      Boolean virtualTimeFlag = False;
+      Boolean batchFlag = False;
+      int timerMode = REAL_TIME_MODE;
+      int workerCount = 1;
       int argIndex = 1;
       int lastFourLetters = 4;
       int fileStrLen, fileStrSubLoc;
       char fileName[ STD_STR_LEN ];
+      char manifestName[ STD_STR_LEN ];
       char errorMessage[ MAX_STR_LEN ];
       ConfigDataType *configDataPtr = NULL;
       OpCodeType *metaDataPtr = NULL;
+      SimContext simContext;
       
       // show title
          // function: printf
@@ -83,6 +91,36 @@ int main( int argc, char **argv )
          // set run simulator flag
          runSimFlag = True;
       }   
+      // otherwise, check for the -vt (virtual time)
+         // function: compareString
+      else if( compareString( argv[ argIndex ], "-vt" ) == STR_EQ )
+      {
+         // set virtual time flag
+         virtualTimeFlag = True;
+      }
+      // otherwise, check for -batch (run a manifest of jobs)
+         // function: compareString
+      else if( compareString( argv[ argIndex ], "-batch" ) == STR_EQ
+               && argIndex + 1 < argc )
+      {
+         // move to the manifest name and keep it
+            // function: copyString
+         argIndex++;
+         copyString( manifestName, argv[ argIndex ] );
+         
+         // set batch flag
+         batchFlag = True;
+      }
+      // otherwise, check for -j (batch worker count)
+         // function: compareString
+      else if( compareString( argv[ argIndex ], "-j" ) == STR_EQ
+               && argIndex + 1 < argc )
+      {
+         // move to the count and read it
+            // function: getNumberArg
+         argIndex++;
+         getNumberArg( &workerCount, argv[ argIndex ], 0 );
+      }
       // otherwise, must check for file name, ending in .cnf
       // must be last flag
       else if( fileStrSubLoc != SUBSTRING_NOT_FOUND
@@ -100,8 +138,35 @@ int main( int argc, char **argv )
    }
    // end loop arg
    
+   // check for virtual time request
+   if( virtualTimeFlag == True )
+   {
+      // advance a simulated clock instead of waiting on the wall clock
+      timerMode = VIRTUAL_TIME_MODE;
+   }
+   
+   // check for a batch run
+   if( batchFlag == True )
+   {
+      // check for a bad worker count
+      if( workerCount < 1 )
+      {
+         // show error message
+            // function: printf
+         printf( "Incorrect worker count, program aborted\n\n" );
+      }
+      // otherwise, run the manifest, check for failure
+         // function: runBatch
+      else if( runBatch( manifestName, workerCount, timerMode, 
+                                                      errorMessage ) == False )
+      {
+         // show error message
+            // function: printf
+         printf( "\nBatch Error: %s, program aborted\n\n", errorMessage );
+      }
+   }
    // check for command line failure
-   if( programRunFlag == False && infoFlag == False )
+   else if( programRunFlag == False && infoFlag == False )
    {
    
       // show error message, end program
@@ -159,9 +224,17 @@ int main( int argc, char **argv )
          // check run simulator flag
          if( runSimFlag == True )
          {
+            // set up the state for this simulation
+               // function: initSimContext
+            initSimContext( &simContext, configDataPtr, timerMode );
+            
             // run simulator
                // function: runSim
-            runSim( configDataPtr, metaDataPtr );
+            runSim( &simContext, metaDataPtr );
+            
+            // release the simulation state
+               // function: clearSimContext
+            clearSimContext( &simContext );
          }
       }      
       // otherwise, assume meta data upload failure
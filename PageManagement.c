@@ -0,0 +1,1086 @@
+#include "PageManagement.h"
+#include "DisplayLog.h"
+
+/*
+Funtion name: initPaging
+Algorithm: with a page size set, makes every frame of the memory free,
+           splits the page number bits evenly over the page table levels
+           and sets up the TLB of the one cpu
+Precondition: context config data is set
+Postcondiditon: no page is mapped, the TLB is empty
+Exceptions: a page size of zero leaves paging off
+Note: the last frame may be partly past the configured memory, so every
+      address has a frame; with resident frames set there are only that
+      many, and the memory is the space the pages are loaded from
+*/
+void initPaging( SimContext *simContext )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int pageSize = configPtr->pageSize;
+   int pageCount;
+   int frameCount;
+   int pageBits = 0;
+   int frameIndex = 0;
+
+   simContext->freeFrameArray = NULL;
+   simContext->freeFrameCount = 0;
+   simContext->frameCount = 0;
+   simContext->pageLevelBits = 0;
+
+   simContext->frameTable = NULL;
+   simContext->clockHand = 0;
+   simContext->referenceCounter = 0;
+   simContext->windowArray = NULL;
+   simContext->windowCount = 0;
+   simContext->windowCapacity = 0;
+
+   simContext->pagingReport.hitCount = 0;
+   simContext->pagingReport.missCount = 0;
+   simContext->pagingReport.translationMS = 0;
+   simContext->pagingReport.hitPercent = 0.0;
+   simContext->pagingReport.faultCount = 0;
+   simContext->pagingReport.evictCount = 0;
+   simContext->pagingReport.faultPercent = 0.0;
+   simContext->pagingReport.thrashCount = 0;
+
+      // function: initTlb
+   initTlb( &simContext->tlb, configPtr );
+
+   // check for paging off
+   if( pageSize == 0 )
+   {
+      return;
+   }
+
+   // one frame per page of the address space, unless fewer are resident
+   pageCount = configPtr->memAvailable / pageSize + 1;
+   frameCount = pageCount;
+
+   if( configPtr->residentFrameCount > 0 )
+   {
+      frameCount = configPtr->residentFrameCount;
+   }
+
+   simContext->frameCount = frameCount;
+
+   // function: malloc
+   simContext->freeFrameArray = (int *)malloc( frameCount * sizeof( int ) );
+   simContext->frameTable = (FrameEntry *)malloc( frameCount
+                                                    * sizeof( FrameEntry ) );
+
+   // stack the frames so the lowest frame is taken first
+   while( frameIndex < frameCount )
+   {
+      simContext->freeFrameArray[ frameIndex ] = frameCount - 1 - frameIndex;
+      simContext->frameTable[ frameIndex ].ownerPcb = NULL;
+
+      frameIndex++;
+   }
+
+   simContext->freeFrameCount = frameCount;
+
+   // find the bits of a page number, at least one per level
+   while( ( 1 << pageBits ) < pageCount )
+   {
+      pageBits++;
+   }
+
+   simContext->pageLevelBits = ( pageBits + configPtr->pageLevelCount - 1 )
+                                                / configPtr->pageLevelCount;
+
+   if( simContext->pageLevelBits < 1 )
+   {
+      simContext->pageLevelBits = 1;
+   }
+}
+
+/*
+Funtion name: clearPaging
+Algorithm: returns the free frame stack, the frame table, the fault
+           windows and the TLB of the one cpu to the OS
+Precondition: every process has exited, so no page is mapped
+Postcondiditon: paging memory, if any, is returned to OS
+Exceptions: none
+Note: none
+*/
+void clearPaging( SimContext *simContext )
+{
+   // function: free, clearTlb
+   free( simContext->freeFrameArray );
+   simContext->freeFrameArray = NULL;
+   simContext->freeFrameCount = 0;
+
+   free( simContext->frameTable );
+   simContext->frameTable = NULL;
+
+   free( simContext->windowArray );
+   simContext->windowArray = NULL;
+   simContext->windowCount = 0;
+   simContext->windowCapacity = 0;
+
+   clearTlb( &simContext->tlb );
+}
+
+/*
+Funtion name: initTlb
+Algorithm: with a page size set, allocates the configured TLB entries,
+           all of them empty
+Precondition: config data is set
+Postcondiditon: TLB is empty
+Exceptions: a page size of zero leaves the TLB without entries
+Note: the random replacement generator starts at the same state in every
+      run
+*/
+void initTlb( Tlb *tlb, ConfigDataType *configPtr )
+{
+   tlb->entryArray = NULL;
+   tlb->entryCount = 0;
+   tlb->entryCapacity = 0;
+   tlb->lookupCounter = 0;
+   tlb->randomState = 1;
+
+   // check for paging on
+   if( configPtr->pageSize > 0 )
+   {
+      // function: malloc
+      tlb->entryArray = (TlbEntry *)malloc( configPtr->tlbEntryCount
+                                                      * sizeof( TlbEntry ) );
+      tlb->entryCapacity = configPtr->tlbEntryCount;
+   }
+}
+
+/*
+Funtion name: clearTlb
+Algorithm: returns the TLB entries to the OS
+Precondition: TLB, with or without entries
+Postcondiditon: TLB memory, if any, is returned to OS, the TLB is empty
+Exceptions: none
+Note: none
+*/
+void clearTlb( Tlb *tlb )
+{
+   // function: free
+   free( tlb->entryArray );
+
+   tlb->entryArray = NULL;
+   tlb->entryCount = 0;
+   tlb->entryCapacity = 0;
+}
+
+/*
+Funtion name: findPageSlot
+Algorithm: walks the page table of the process from the root, taking the
+           index of each level from the page number bits, high bits first
+Precondition: paging is on
+Postcondiditon: returns the frame slot of the page in its leaf, or null
+                if a node on the way is missing and is not to be created
+Exceptions: none
+Note: created inner nodes start empty and created leaves start unmapped
+*/
+int *findPageSlot( SimContext *simContext, PCB *pcb, int pageNumber,
+                                                       Boolean createFlag )
+{
+   // initialize variables
+   int levelCount = simContext->configPtr->pageLevelCount;
+   int levelBits = simContext->pageLevelBits;
+   int fanOut = 1 << levelBits;
+   PageNode **nodeSlot = &pcb->pageTable;
+   PageNode *pageNode;
+   int levelIndex = 0;
+   int entryIndex = 0;
+   int childIndex;
+
+   // loop down the levels
+   while( levelIndex < levelCount )
+   {
+      // check for a missing node
+      if( *nodeSlot == NULL )
+      {
+         // check for a lookup only
+         if( createFlag == False )
+         {
+            return NULL;
+         }
+
+         // function: malloc
+         pageNode = (PageNode *)malloc( sizeof( PageNode ) );
+         pageNode->childArray = NULL;
+         pageNode->frameArray = NULL;
+         childIndex = 0;
+
+         // check for a leaf
+         if( levelIndex == levelCount - 1 )
+         {
+            pageNode->frameArray = (int *)malloc( fanOut * sizeof( int ) );
+
+            while( childIndex < fanOut )
+            {
+               pageNode->frameArray[ childIndex ] = -1;
+
+               childIndex++;
+            }
+         }
+         // otherwise, assume an inner node
+         else
+         {
+            pageNode->childArray = (PageNode **)malloc( fanOut
+                                                    * sizeof( PageNode * ) );
+
+            while( childIndex < fanOut )
+            {
+               pageNode->childArray[ childIndex ] = NULL;
+
+               childIndex++;
+            }
+         }
+
+         *nodeSlot = pageNode;
+      }
+
+      // the index into this level
+      entryIndex = ( pageNumber >> ( levelBits * ( levelCount - 1
+                                        - levelIndex ) ) ) & ( fanOut - 1 );
+
+      // step down unless this is the leaf
+      if( levelIndex < levelCount - 1 )
+      {
+         nodeSlot = &( *nodeSlot )->childArray[ entryIndex ];
+      }
+
+      levelIndex++;
+   }
+
+   return &( *nodeSlot )->frameArray[ entryIndex ];
+}
+
+/*
+Funtion name: hasFreeFrames
+Algorithm: counts the pages of the range the process has not mapped yet
+           and compares them with the free frames
+Precondition: paging is on, bounds are inclusive
+Postcondiditon: returns whether every page of the range can be mapped
+Exceptions: with resident frames set, pages take frames when they are
+            used, so there is always room
+Note: pages the process already maps ( shared with its other blocks ) need
+      no frame
+*/
+Boolean hasFreeFrames( SimContext *simContext, PCB *pcb, int lowerBound,
+                                                           int upperBound )
+{
+   // initialize variables
+   int pageSize = simContext->configPtr->pageSize;
+   int pageNumber = lowerBound / pageSize;
+   int newPageCount = 0;
+   int *frameSlot;
+
+   // check for demand paging
+   if( simContext->configPtr->residentFrameCount > 0 )
+   {
+      return True;
+   }
+
+   // loop across the pages of the range
+   while( pageNumber <= upperBound / pageSize )
+   {
+      // function: findPageSlot
+      frameSlot = findPageSlot( simContext, pcb, pageNumber, False );
+
+      if( frameSlot == NULL || *frameSlot < 0 )
+      {
+         newPageCount++;
+      }
+
+      pageNumber++;
+   }
+
+   // check for more new pages than free frames
+   if( newPageCount > simContext->freeFrameCount )
+   {
+      return False;
+   }
+
+   return True;
+}
+
+/*
+Funtion name: mapPages
+Algorithm: gives each page of the range the process has not mapped yet
+           the next free frame
+Precondition: paging is on, the free frames hold the range
+Postcondiditon: every page of the range is mapped
+Exceptions: with resident frames set, nothing is mapped until a page is
+            used
+Note: none
+*/
+void mapPages( SimContext *simContext, PCB *pcb, int lowerBound,
+                                                           int upperBound )
+{
+   // initialize variables
+   int pageSize = simContext->configPtr->pageSize;
+   int pageNumber = lowerBound / pageSize;
+   int *frameSlot;
+
+   // check for demand paging
+   if( simContext->configPtr->residentFrameCount > 0 )
+   {
+      return;
+   }
+
+   // loop across the pages of the range
+   while( pageNumber <= upperBound / pageSize )
+   {
+      // function: findPageSlot
+      frameSlot = findPageSlot( simContext, pcb, pageNumber, True );
+
+      if( *frameSlot < 0 )
+      {
+            // function: loadFrame
+         simContext->freeFrameCount--;
+         *frameSlot = simContext->freeFrameArray[
+                                              simContext->freeFrameCount ];
+         loadFrame( simContext, *frameSlot, pcb, pageNumber );
+      }
+
+      pageNumber++;
+   }
+}
+
+/*
+Funtion name: unmapPages
+Algorithm: frees the page table of the process, returning its frames
+Precondition: paging is on
+Postcondiditon: process maps no page
+Exceptions: none
+Note: none
+*/
+void unmapPages( SimContext *simContext, PCB *pcb )
+{
+   // function: freePageNode
+   freePageNode( simContext, pcb->pageTable, 0 );
+
+   pcb->pageTable = NULL;
+}
+
+/*
+Funtion name: freePageNode
+Algorithm: frees the nodes below an inner node, or pushes the mapped
+           frames of a leaf back on the free stack, then frees the node
+Precondition: node of the given level, or null
+Postcondiditon: node memory is returned to OS
+Exceptions: none
+Note: recursive, at most the configured level count deep
+*/
+void freePageNode( SimContext *simContext, PageNode *pageNode,
+                                                            int levelIndex )
+{
+   // initialize variables
+   int fanOut = 1 << simContext->pageLevelBits;
+   int childIndex = 0;
+
+   // check for no node
+   if( pageNode == NULL )
+   {
+      return;
+   }
+
+   // loop across the entries
+   while( childIndex < fanOut )
+   {
+      // check for a leaf with the page mapped
+      if( pageNode->frameArray != NULL )
+      {
+         if( pageNode->frameArray[ childIndex ] >= 0 )
+         {
+            simContext->freeFrameArray[ simContext->freeFrameCount ] =
+                                           pageNode->frameArray[ childIndex ];
+            simContext->freeFrameCount++;
+
+            simContext->frameTable[ pageNode->frameArray[ childIndex ] ]
+                                                          .ownerPcb = NULL;
+         }
+      }
+      // otherwise, assume an inner node
+      else
+      {
+         // function: freePageNode
+         freePageNode( simContext, pageNode->childArray[ childIndex ],
+                                                            levelIndex + 1 );
+      }
+
+      childIndex++;
+   }
+
+   // function: free
+   free( pageNode->frameArray );
+   free( pageNode->childArray );
+   free( pageNode );
+}
+
+/*
+Funtion name: translateAccess
+Algorithm: looks up each page of the range in the TLB; a miss walks the
+           page table of the process and loads the page into the TLB, and
+           a page not in memory takes a frame, a page fault
+Precondition: paging is on, the access is inside blocks of the process
+Postcondiditon: the lookups and the translation time are added to the
+                process, the pages it faulted are its swap pages; returns
+                the translation time in ms
+Exceptions: none
+Note: a miss costs the miss cycles and the walk cycles of each level; the
+      pages of the access are never evicted for each other
+*/
+int translateAccess( SimContext *simContext, Tlb *tlb, PCB *pcb,
+                            int lowerBound, int upperBound, int accessMSec )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int pageSize = configPtr->pageSize;
+   int pageNumber = lowerBound / pageSize;
+   long long startStamp = simContext->referenceCounter + 1;
+   int missCount = 0;
+   int translationMS;
+   int entryIndex;
+   int frameNumber;
+   int *frameSlot;
+
+   pcb->swapPageCount = 0;
+
+   // loop across the pages of the access
+   while( pageNumber <= upperBound / pageSize )
+   {
+      // check for a TLB hit
+         // function: lookupTlb
+      entryIndex = lookupTlb( tlb, pcb->pid, pageNumber );
+
+      if( entryIndex >= 0 )
+      {
+         frameNumber = tlb->entryArray[ entryIndex ].frameNumber;
+
+         pcb->tlbHitCount++;
+      }
+      // otherwise, walk the page table and load the TLB
+      else
+      {
+         // a page not loaded yet gets its table nodes now
+            // function: findPageSlot
+         frameSlot = findPageSlot( simContext, pcb, pageNumber, True );
+
+         // check for a page fault
+         if( *frameSlot < 0 )
+         {
+               // function: takeFrame, loadFrame
+            *frameSlot = takeFrame( simContext, startStamp, accessMSec );
+            loadFrame( simContext, *frameSlot, pcb, pageNumber );
+
+            pcb->swapPageCount++;
+            pcb->pageFaultCount++;
+         }
+
+         frameNumber = *frameSlot;
+
+            // function: insertTlb
+         insertTlb( tlb, configPtr, pcb->pid, pageNumber, frameNumber );
+
+         pcb->tlbMissCount++;
+         missCount++;
+      }
+
+      // function: touchFrame
+      touchFrame( simContext, frameNumber, accessMSec );
+
+      pageNumber++;
+   }
+
+   translationMS = missCount * ( configPtr->tlbMissCycles
+                 + configPtr->pageLevelCount * configPtr->pageWalkCycles )
+                                                  * configPtr->procCycleRate;
+
+   pcb->translationMS = pcb->translationMS + translationMS;
+
+   return translationMS;
+}
+
+/*
+Funtion name: lookupTlb
+Algorithm: searches the entries for the page of the process and stamps a
+           found entry as the latest used
+Precondition: TLB with entries
+Postcondiditon: returns the index of the entry, or -1 on a miss
+Exceptions: none
+Note: a hardware TLB compares every entry at once, so the search is free
+*/
+int lookupTlb( Tlb *tlb, int pid, int pageNumber )
+{
+   // initialize variables
+   int entryIndex = 0;
+
+   tlb->lookupCounter++;
+
+   // loop across the entries
+   while( entryIndex < tlb->entryCount )
+   {
+      // check for the page of the process
+      if( tlb->entryArray[ entryIndex ].pid == pid
+                && tlb->entryArray[ entryIndex ].pageNumber == pageNumber )
+      {
+         tlb->entryArray[ entryIndex ].useStamp = tlb->lookupCounter;
+
+         return entryIndex;
+      }
+
+      entryIndex++;
+   }
+
+   return -1;
+}
+
+/*
+Funtion name: insertTlb
+Algorithm: adds the page to a free entry, or replaces the least recently
+           used entry or a random one, as configured
+Precondition: page is not in the TLB
+Postcondiditon: TLB holds the page, stamped as the latest used
+Exceptions: none
+Note: the random generator is a fixed linear congruential one, so a run
+      is repeatable
+*/
+void insertTlb( Tlb *tlb, ConfigDataType *configPtr, int pid,
+                                           int pageNumber, int frameNumber )
+{
+   // initialize variables
+   int entryIndex = tlb->entryCount;
+   int scanIndex = 1;
+
+   // check for a full TLB
+   if( tlb->entryCount == tlb->entryCapacity )
+   {
+      // check for random replacement
+      if( configPtr->tlbPolicyCode == TLB_RANDOM_CODE )
+      {
+         tlb->randomState = tlb->randomState * 1103515245 + 12345;
+         entryIndex = ( tlb->randomState >> 16 ) % tlb->entryCapacity;
+      }
+      // otherwise, assume LRU
+      else
+      {
+         entryIndex = 0;
+
+         while( scanIndex < tlb->entryCount )
+         {
+            if( tlb->entryArray[ scanIndex ].useStamp
+                                  < tlb->entryArray[ entryIndex ].useStamp )
+            {
+               entryIndex = scanIndex;
+            }
+
+            scanIndex++;
+         }
+      }
+   }
+   // otherwise, take the next free entry
+   else
+   {
+      tlb->entryCount++;
+   }
+
+   tlb->entryArray[ entryIndex ].pid = pid;
+   tlb->entryArray[ entryIndex ].pageNumber = pageNumber;
+   tlb->entryArray[ entryIndex ].frameNumber = frameNumber;
+   tlb->entryArray[ entryIndex ].useStamp = tlb->lookupCounter;
+}
+
+/*
+Funtion name: invalidateTlb
+Algorithm: removes the entry of the page of the process, if any, moving
+           the last entry into its place
+Precondition: TLB, with or without entries
+Postcondiditon: TLB does not hold the page
+Exceptions: none
+Note: none
+*/
+void invalidateTlb( Tlb *tlb, int pid, int pageNumber )
+{
+   // initialize variables
+   int entryIndex = 0;
+
+   // loop across the entries
+   while( entryIndex < tlb->entryCount )
+   {
+      // check for the page of the process
+      if( tlb->entryArray[ entryIndex ].pid == pid
+                && tlb->entryArray[ entryIndex ].pageNumber == pageNumber )
+      {
+         tlb->entryCount--;
+         tlb->entryArray[ entryIndex ] =
+                                    tlb->entryArray[ tlb->entryCount ];
+
+         return;
+      }
+
+      entryIndex++;
+   }
+}
+
+/*
+Funtion name: takeFrame
+Algorithm: takes a free frame, or evicts the page the replacement policy
+           chooses and takes its frame
+Precondition: demand paging is on, a frame not used by the access exists
+Postcondiditon: returns a frame with no page
+Exceptions: none
+Note: the window of the access counts an eviction
+*/
+int takeFrame( SimContext *simContext, long long startStamp, int accessMSec )
+{
+   // initialize variables
+   int frameNumber;
+
+   // check for a free frame
+   if( simContext->freeFrameCount > 0 )
+   {
+      simContext->freeFrameCount--;
+
+      return simContext->freeFrameArray[ simContext->freeFrameCount ];
+   }
+
+   // function: findVictim, evictFrame, findFaultWindow
+   frameNumber = findVictim( simContext, startStamp, accessMSec );
+   evictFrame( simContext, frameNumber );
+   findFaultWindow( simContext, accessMSec )->evictCount++;
+
+   return frameNumber;
+}
+
+/*
+Funtion name: findVictim
+Algorithm: FIFO takes the page loaded first and LRU the page used least
+           recently; Clock sweeps the hand, clearing reference bits, to
+           the first page not referenced; WSClock sweeps the same way to
+           the first page not referenced and out of the working set
+           window, or after two turns takes the page used longest ago
+Precondition: every frame holds a page, one is not used by the access
+Postcondiditon: returns the frame of the victim, the clock hand is past
+                it
+Exceptions: none
+Note: pages used at or after the start stamp belong to the access and
+      are skipped
+*/
+int findVictim( SimContext *simContext, long long startStamp, int accessMSec )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   FrameEntry *frameTable = simContext->frameTable;
+   int frameCount = simContext->frameCount;
+   int victimIndex = -1;
+   int oldestIndex = -1;
+   int frameIndex = 0;
+   int scanCount = 0;
+   FrameEntry *frameEntry;
+
+   // check for a clock policy
+   if( configPtr->pageReplaceCode == PAGE_CLOCK_CODE
+                        || configPtr->pageReplaceCode == PAGE_WSCLOCK_CODE )
+   {
+      // sweep until a victim is found, two turns at most
+      while( victimIndex < 0 && scanCount < 2 * frameCount )
+      {
+         frameIndex = simContext->clockHand;
+         frameEntry = &frameTable[ frameIndex ];
+         simContext->clockHand = ( frameIndex + 1 ) % frameCount;
+
+         // check for a page not used by the access
+         if( frameEntry->useStamp < startStamp )
+         {
+            // a referenced page gets another turn
+            if( frameEntry->referenceFlag == True )
+            {
+               frameEntry->referenceFlag = False;
+            }
+            // otherwise, Clock takes it, WSClock only out of the window
+            else if( configPtr->pageReplaceCode == PAGE_CLOCK_CODE
+                     || accessMSec - frameEntry->useMSec
+                                                 > configPtr->workingSetMS )
+            {
+               victimIndex = frameIndex;
+            }
+            // otherwise, keep the page used longest ago
+            else if( oldestIndex < 0
+                  || frameEntry->useMSec < frameTable[ oldestIndex ].useMSec )
+            {
+               oldestIndex = frameIndex;
+            }
+         }
+
+         scanCount++;
+      }
+
+      // check for every page in the working set
+      if( victimIndex < 0 )
+      {
+         victimIndex = oldestIndex;
+      }
+
+      return victimIndex;
+   }
+
+   // loop across the frames for FIFO or LRU
+   while( frameIndex < frameCount )
+   {
+      frameEntry = &frameTable[ frameIndex ];
+
+      // check for a page not used by the access
+      if( frameEntry->useStamp < startStamp )
+      {
+         // FIFO keeps the earliest load, LRU the earliest use
+         if( victimIndex < 0 )
+         {
+            victimIndex = frameIndex;
+         }
+         else if( configPtr->pageReplaceCode == PAGE_LRU_CODE )
+         {
+            if( frameEntry->useStamp < frameTable[ victimIndex ].useStamp )
+            {
+               victimIndex = frameIndex;
+            }
+         }
+         else if( frameEntry->loadStamp
+                                   < frameTable[ victimIndex ].loadStamp )
+         {
+            victimIndex = frameIndex;
+         }
+      }
+
+      frameIndex++;
+   }
+
+   return victimIndex;
+}
+
+/*
+Funtion name: evictFrame
+Algorithm: unmaps the page in the frame from the page table of its
+           process and drops it from the TLB of every cpu
+Precondition: frame holds a page
+Postcondiditon: frame holds no page, the eviction is counted
+Exceptions: none
+Note: pages are clean copies of the swap, so nothing is written back
+*/
+void evictFrame( SimContext *simContext, int frameNumber )
+{
+   // initialize variables
+   FrameEntry *frameEntry = &simContext->frameTable[ frameNumber ];
+   PCB *ownerPcb = frameEntry->ownerPcb;
+   int coreIndex = 0;
+
+   // function: findPageSlot, invalidateTlb
+   *findPageSlot( simContext, ownerPcb, frameEntry->pageNumber, False ) = -1;
+   invalidateTlb( &simContext->tlb, ownerPcb->pid, frameEntry->pageNumber );
+
+   // loop across the cores of a multi-core run
+   while( simContext->coreArray != NULL && coreIndex < simContext->coreCount )
+   {
+      // function: invalidateTlb
+      invalidateTlb( &simContext->coreArray[ coreIndex ].tlb, ownerPcb->pid,
+                                                   frameEntry->pageNumber );
+
+      coreIndex++;
+   }
+
+   frameEntry->ownerPcb = NULL;
+   simContext->pagingReport.evictCount++;
+}
+
+/*
+Funtion name: loadFrame
+Algorithm: records the page of the process in the frame, loaded now
+Precondition: frame holds no page
+Postcondiditon: frame holds the page, not referenced yet
+Exceptions: none
+Note: none
+*/
+void loadFrame( SimContext *simContext, int frameNumber, PCB *pcb,
+                                                            int pageNumber )
+{
+   // initialize variables
+   FrameEntry *frameEntry = &simContext->frameTable[ frameNumber ];
+
+   frameEntry->ownerPcb = pcb;
+   frameEntry->pageNumber = pageNumber;
+   frameEntry->loadStamp = simContext->referenceCounter;
+   frameEntry->useStamp = simContext->referenceCounter;
+   frameEntry->useMSec = 0;
+   frameEntry->referenceFlag = False;
+}
+
+/*
+Funtion name: touchFrame
+Algorithm: counts a reference to the page in the frame, stamping its use
+           and setting its reference bit
+Precondition: frame holds a page
+Postcondiditon: frame is the latest used; with demand paging, the window
+                of the access counts the reference
+Exceptions: none
+Note: none
+*/
+void touchFrame( SimContext *simContext, int frameNumber, int accessMSec )
+{
+   // initialize variables
+   FrameEntry *frameEntry = &simContext->frameTable[ frameNumber ];
+
+   simContext->referenceCounter++;
+
+   frameEntry->useStamp = simContext->referenceCounter;
+   frameEntry->useMSec = accessMSec;
+   frameEntry->referenceFlag = True;
+
+   // check for demand paging
+   if( simContext->configPtr->residentFrameCount > 0 )
+   {
+      // function: findFaultWindow
+      findFaultWindow( simContext, accessMSec )->referenceCount++;
+   }
+}
+
+/*
+Funtion name: findFaultWindow
+Algorithm: returns the working set window holding the time, adding empty
+           windows up to it, the array doubling when full
+Precondition: demand paging is on
+Postcondiditon: windows up to the time exist
+Exceptions: none
+Note: none
+*/
+FaultWindow *findFaultWindow( SimContext *simContext, int accessMSec )
+{
+   // initialize variables
+   int windowIndex = accessMSec / simContext->configPtr->workingSetMS;
+
+   // loop until the window exists
+   while( simContext->windowCount <= windowIndex )
+   {
+      // check for a full array
+      if( simContext->windowCount == simContext->windowCapacity )
+      {
+         simContext->windowCapacity = simContext->windowCapacity * 2 + 8;
+
+         // function: realloc
+         simContext->windowArray = (FaultWindow *)realloc(
+                       simContext->windowArray,
+                       simContext->windowCapacity * sizeof( FaultWindow ) );
+      }
+
+      simContext->windowArray[ simContext->windowCount ].referenceCount = 0;
+      simContext->windowArray[ simContext->windowCount ].evictCount = 0;
+      simContext->windowCount++;
+   }
+
+   return &simContext->windowArray[ windowIndex ];
+}
+
+/*
+Funtion name: startPageFault
+Algorithm: sets the op of the process to the swap in of its faulted
+           pages, each one an input cycle of the swap device
+Precondition: the access faulted at least one page
+Postcondiditon: op ms is the swap time, added to the process time left so
+                the IO completion takes it back off
+Exceptions: none
+Note: none
+*/
+void startPageFault( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   int swapMS = pcb->swapPageCount
+        * simContext->configPtr->deviceTable[ DEVICE_SWAP ].inCycleRate;
+
+   pcb->opMSLeft = swapMS;
+   pcb->msLeft = pcb->msLeft + swapMS;
+
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, pcb, PAGE_FAULT, NONE );
+}
+
+/*
+Funtion name: reportPaging
+Algorithm: sets the TLB hit rate of each process that looked up a page
+           and logs it with its translation time, then sums them over the
+           run and logs the totals
+Precondition: every process is in EXIT
+Postcondiditon: paging summary is set and logged
+Exceptions: a run with paging off is not logged
+Note: none
+*/
+void reportPaging( SimContext *simContext )
+{
+   // initialize variables
+   PagingReport *pagingReport = &simContext->pagingReport;
+   PCB *localPtr = simContext->pcbListHead;
+   int lookupCount;
+
+   // check for paging off
+   if( simContext->configPtr->pageSize == 0 )
+   {
+      return;
+   }
+
+   // loop across the processes
+   while( localPtr != NULL )
+   {
+      lookupCount = localPtr->tlbHitCount + localPtr->tlbMissCount;
+
+      // check for a process that looked up a page
+      if( lookupCount > 0 )
+      {
+         localPtr->tlbHitPercent = (double)localPtr->tlbHitCount * 100
+                                                               / lookupCount;
+
+         pagingReport->hitCount = pagingReport->hitCount
+                                                     + localPtr->tlbHitCount;
+         pagingReport->missCount = pagingReport->missCount
+                                                    + localPtr->tlbMissCount;
+         pagingReport->translationMS = pagingReport->translationMS
+                                                   + localPtr->translationMS;
+
+         // log event
+            // function: displayAndLog
+         displayAndLog( simContext, localPtr, PROCESS_PAGING, NONE );
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   lookupCount = pagingReport->hitCount + pagingReport->missCount;
+
+   if( lookupCount > 0 )
+   {
+      pagingReport->hitPercent = (double)pagingReport->hitCount * 100
+                                                               / lookupCount;
+   }
+
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, PAGING_REPORT, NONE );
+
+   // check for demand paging
+   if( simContext->configPtr->residentFrameCount > 0 )
+   {
+      // function: reportFaults
+      reportFaults( simContext );
+   }
+}
+
+/*
+Funtion name: reportFaults
+Algorithm: logs the page faults and fault rate of each process that
+           referenced a page and of the run, then each span of windows
+           in a row whose eviction rate reaches the thrashing rate, and
+           the count of those windows
+Precondition: every process is in EXIT, demand paging is on
+Postcondiditon: fault summary is set and logged
+Exceptions: none
+Note: the rates are per page reference; only faults that evict a page
+      count toward thrashing, so the first loads of the pages do not
+*/
+void reportFaults( SimContext *simContext )
+{
+   // initialize variables
+   PagingReport *pagingReport = &simContext->pagingReport;
+   int workingSetMS = simContext->configPtr->workingSetMS;
+   int thrashPercent = simContext->configPtr->thrashPercent;
+   PCB *localPtr = simContext->pcbListHead;
+   FaultWindow *faultWindow;
+   int windowIndex = 0;
+   int spanReferences = 0;
+   int spanEvicts = 0;
+   int referenceCount;
+   Boolean thrashFlag;
+
+   // loop across the processes
+   while( localPtr != NULL )
+   {
+      referenceCount = localPtr->tlbHitCount + localPtr->tlbMissCount;
+
+      // check for a process that referenced a page
+      if( referenceCount > 0 )
+      {
+         localPtr->faultPercent = (double)localPtr->pageFaultCount * 100
+                                                            / referenceCount;
+
+         pagingReport->faultCount = pagingReport->faultCount
+                                                  + localPtr->pageFaultCount;
+
+         // log event
+            // function: displayAndLog
+         displayAndLog( simContext, localPtr, PROCESS_FAULTS, NONE );
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   referenceCount = pagingReport->hitCount + pagingReport->missCount;
+
+   if( referenceCount > 0 )
+   {
+      pagingReport->faultPercent = (double)pagingReport->faultCount * 100
+                                                            / referenceCount;
+   }
+
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, FAULT_REPORT, NONE );
+
+   // loop across the windows, one past the last to end a span there
+   while( windowIndex <= simContext->windowCount )
+   {
+      thrashFlag = False;
+
+      // check for a window at the thrashing rate
+      if( windowIndex < simContext->windowCount )
+      {
+         faultWindow = &simContext->windowArray[ windowIndex ];
+
+         if( faultWindow->referenceCount > 0
+             && faultWindow->evictCount * 100
+                             >= thrashPercent * faultWindow->referenceCount )
+         {
+            thrashFlag = True;
+         }
+      }
+
+      // check for a window in a span
+      if( thrashFlag == True )
+      {
+         // check for the start of a span
+         if( spanReferences == 0 )
+         {
+            pagingReport->spanStartMSec = windowIndex * workingSetMS;
+         }
+
+         spanReferences = spanReferences + faultWindow->referenceCount;
+         spanEvicts = spanEvicts + faultWindow->evictCount;
+         pagingReport->thrashCount++;
+      }
+      // otherwise, check for the end of a span
+      else if( spanReferences > 0 )
+      {
+         pagingReport->spanEndMSec = windowIndex * workingSetMS;
+         pagingReport->spanPercent = (double)spanEvicts * 100
+                                                            / spanReferences;
+
+         // log event
+            // function: displayAndLog
+         displayAndLog( simContext, NULL, THRASH_SPAN, NONE );
+
+         spanReferences = 0;
+         spanEvicts = 0;
+      }
+
+      windowIndex++;
+   }
+
+   // log event
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, THRASH_REPORT, NONE );
+}
@@ -0,0 +1,43 @@
+// Pre-compiler directive
+#ifndef PAGE_MANAGEMENT_H
+#define PAGE_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include "StringUtils.h"
+#include "simulator.h"
+
+// function prototypes
+void initPaging( SimContext *simContext );
+void clearPaging( SimContext *simContext );
+void initTlb( Tlb *tlb, ConfigDataType *configPtr );
+void clearTlb( Tlb *tlb );
+int *findPageSlot( SimContext *simContext, PCB *pcb, int pageNumber,
+                                                      Boolean createFlag );
+Boolean hasFreeFrames( SimContext *simContext, PCB *pcb, int lowerBound,
+                                                           int upperBound );
+void mapPages( SimContext *simContext, PCB *pcb, int lowerBound,
+                                                           int upperBound );
+void unmapPages( SimContext *simContext, PCB *pcb );
+void freePageNode( SimContext *simContext, PageNode *pageNode,
+                                                           int levelIndex );
+int translateAccess( SimContext *simContext, Tlb *tlb, PCB *pcb,
+                            int lowerBound, int upperBound, int accessMSec );
+int lookupTlb( Tlb *tlb, int pid, int pageNumber );
+void insertTlb( Tlb *tlb, ConfigDataType *configPtr, int pid,
+                                          int pageNumber, int frameNumber );
+void invalidateTlb( Tlb *tlb, int pid, int pageNumber );
+int takeFrame( SimContext *simContext, long long startStamp, int accessMSec );
+int findVictim( SimContext *simContext, long long startStamp,
+                                                           int accessMSec );
+void evictFrame( SimContext *simContext, int frameNumber );
+void loadFrame( SimContext *simContext, int frameNumber, PCB *pcb,
+                                                            int pageNumber );
+void touchFrame( SimContext *simContext, int frameNumber, int accessMSec );
+FaultWindow *findFaultWindow( SimContext *simContext, int accessMSec );
+void startPageFault( SimContext *simContext, PCB *pcb );
+void reportPaging( SimContext *simContext );
+void reportFaults( SimContext *simContext );
+
+#endif   // PAGE_MANAGEMENT_H
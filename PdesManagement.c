@@ -0,0 +1,675 @@
+// needed for pthread_barrier_t
+#define _POSIX_C_SOURCE 200112L
+
+#include "PdesManagement.h"
+#include "SmpManagement.h"
+#include "QueueManagement.h"
+
+/*
+Funtion name: runPdesSim
+Algorithm: runs the cores of a multi-core run on several host threads;
+           time is cut into epochs one balance tick long, the workers run
+           their own cores through an epoch in ( time, core ) order and
+           meet at a barrier, where one worker merges the epoch's log lines
+           in ( time, core ) order, balances the cores and picks the next
+           epoch; shared events ( mem ops and exits ) wait until every
+           other worker has passed their ( time, core ) key
+Precondition: cores are set up, virtual time, more than one worker
+Postcondiditon: all processes are in EXIT state, the log is the log of the
+                single threaded run
+Exceptions: none
+Note: the run context clock ends at the last event time
+*/
+void runPdesSim( SimContext *simContext, int workerCount, int balanceMS )
+{
+   // initialize variables
+   PdesRun pdesRun;
+   PdesWorker *worker;
+   SimContext *shadowContext;
+   int workerIndex = 0;
+   int lastMSec = simContext->simMSec;
+
+   // set up the run
+   pdesRun.simContext = simContext;
+   pdesRun.workerCount = workerCount;
+   pdesRun.balanceMS = balanceMS;
+   pdesRun.epochStart = 0;
+   pdesRun.epochEnd = 0;
+   pdesRun.doneFlag = False;
+
+      // function: malloc, pthread_barrier_init, pthread_mutex_init,
+      //           pthread_cond_init
+   pdesRun.workerArray =
+               (PdesWorker *)malloc( sizeof( PdesWorker ) * workerCount );
+   pthread_barrier_init( &pdesRun.epochBarrier, NULL, workerCount );
+
+   pdesRun.waitingCount = 0;
+   pthread_mutex_init( &pdesRun.progressMutex, NULL );
+   pthread_cond_init( &pdesRun.progressCondition, NULL );
+
+   // set up each worker and its shadow context
+   while( workerIndex < workerCount )
+   {
+      worker = &pdesRun.workerArray[ workerIndex ];
+      shadowContext = &worker->shadowContext;
+
+      worker->workerIndex = workerIndex;
+      worker->pdesRun = &pdesRun;
+      worker->progressKey = 0;
+      worker->lastMSec = simContext->simMSec;
+
+      worker->segmentKeys = NULL;
+      worker->segmentEnds = NULL;
+      worker->segmentCount = 0;
+      worker->segmentCapacity = 0;
+
+      // the shadow keeps its log lines for the merge and never prints
+         // function: initSimContext
+      initSimContext( shadowContext, simContext->configPtr,
+                                               simContext->timer.timerMode );
+      shadowContext->loggingFormatFlag = LOGTO_FILE_CODE;
+      shadowContext->quietFlag = True;
+
+      // it starts from the run clock and shares the cores
+      shadowContext->timer = simContext->timer;
+      shadowContext->simMSec = simContext->simMSec;
+      shadowContext->coreArray = simContext->coreArray;
+      shadowContext->pdesWorker = worker;
+
+      workerIndex++;
+   }
+
+   // start the other workers, this thread runs the first one
+      // function: pthread_create
+   workerIndex = 1;
+
+   while( workerIndex < workerCount )
+   {
+      worker = &pdesRun.workerArray[ workerIndex ];
+
+      pthread_create( &worker->thread, NULL, runPdesWorker, (void *)worker );
+
+      workerIndex++;
+   }
+
+      // function: runPdesWorker
+   runPdesWorker( (void *)&pdesRun.workerArray[ 0 ] );
+
+   // wait for the other workers
+      // function: pthread_join
+   workerIndex = 1;
+
+   while( workerIndex < workerCount )
+   {
+      pthread_join( pdesRun.workerArray[ workerIndex ].thread, NULL );
+
+      workerIndex++;
+   }
+
+   // find the last event time and release the workers
+   workerIndex = 0;
+
+   while( workerIndex < workerCount )
+   {
+      worker = &pdesRun.workerArray[ workerIndex ];
+
+      if( worker->lastMSec > lastMSec )
+      {
+         lastMSec = worker->lastMSec;
+      }
+
+      // the cores belong to the run context
+         // function: clearSimContext, free
+      worker->shadowContext.coreArray = NULL;
+      clearSimContext( &worker->shadowContext );
+
+      free( worker->segmentKeys );
+      free( worker->segmentEnds );
+
+      workerIndex++;
+   }
+
+      // function: pthread_barrier_destroy, pthread_mutex_destroy,
+      //           pthread_cond_destroy, free
+   pthread_barrier_destroy( &pdesRun.epochBarrier );
+   pthread_mutex_destroy( &pdesRun.progressMutex );
+   pthread_cond_destroy( &pdesRun.progressCondition );
+   free( pdesRun.workerArray );
+
+   // run the clock up to the last event
+      // function: runTimer
+   runTimer( &simContext->timer, lastMSec - simContext->simMSec );
+   simContext->simMSec = lastMSec;
+}
+
+/*
+Funtion name: runPdesWorker
+Algorithm: runs epochs until the run is done; the first worker prepares
+           each epoch while the others wait at the barrier
+Precondition: given a worker of a run set up by runPdesSim
+Postcondiditon: run is done
+Exceptions: none
+Note: thread entry point
+*/
+void *runPdesWorker( void *workerPtr )
+{
+   // initialize variables
+   PdesWorker *worker = (PdesWorker *)workerPtr;
+   PdesRun *pdesRun = worker->pdesRun;
+   Boolean firstEpoch = True;
+   Boolean runDone = False;
+
+   // loop until the run is done
+   while( runDone == False )
+   {
+      // check for the first worker
+      if( worker->workerIndex == 0 )
+      {
+         // merge the last epoch and set up the next one
+            // function: startPdesEpoch
+         startPdesEpoch( pdesRun, firstEpoch );
+      }
+
+      firstEpoch = False;
+
+         // function: pthread_barrier_wait
+      pthread_barrier_wait( &pdesRun->epochBarrier );
+
+      runDone = pdesRun->doneFlag;
+
+      // check for an epoch to run
+      if( runDone == False )
+      {
+         // function: runPdesEpoch, pthread_barrier_wait
+         runPdesEpoch( worker );
+
+         pthread_barrier_wait( &pdesRun->epochBarrier );
+      }
+   }
+   // end loop
+
+   return NULL;
+}
+
+/*
+Funtion name: runPdesEpoch
+Algorithm: steps the worker's cores from the epoch start through each of
+           their event times before the epoch end, handling the cores in
+           id order at each time and publishing the key of each core
+           before its events run
+Precondition: epoch was set up by startPdesEpoch
+Postcondiditon: worker's cores have no event left before the epoch end
+Exceptions: none
+Note: every worker steps to the epoch start, where stolen processes wait
+*/
+void runPdesEpoch( PdesWorker *worker )
+{
+   // initialize variables
+   PdesRun *pdesRun = worker->pdesRun;
+   SimContext *shadowContext = &worker->shadowContext;
+   int nextMSec = pdesRun->epochStart;
+   int coreIndex;
+   long long coreKey;
+   fileOutputBuffer *lastLine;
+
+   // loop through the event times of the epoch
+   while( nextMSec >= 0 && nextMSec < pdesRun->epochEnd )
+   {
+      // run the worker clock up to the event time
+         // function: runTimer
+      runTimer( &shadowContext->timer, nextMSec - shadowContext->simMSec );
+      shadowContext->simMSec = nextMSec;
+
+      // handle the events of each core of the worker
+      coreIndex = worker->workerIndex;
+
+      while( coreIndex < shadowContext->coreCount )
+      {
+         // publish the key, shared events before it may now run
+            // function: getPdesKey, publishPdesProgress
+         coreKey = getPdesKey( pdesRun, nextMSec, coreIndex );
+         publishPdesProgress( worker, coreKey );
+
+         // function: runCoreEvents
+         lastLine = shadowContext->logListTail;
+         runCoreEvents( shadowContext,
+                                  &shadowContext->coreArray[ coreIndex ] );
+
+         // check for new log lines
+         if( shadowContext->logListTail != lastLine )
+         {
+            // function: recordPdesSegment
+            recordPdesSegment( worker, coreKey );
+         }
+
+         coreIndex = coreIndex + pdesRun->workerCount;
+      }
+
+      worker->lastMSec = nextMSec;
+
+      // function: findWorkerNextTime
+      nextMSec = findWorkerNextTime( worker );
+   }
+   // end loop
+
+   // the worker is done with the epoch
+      // function: getPdesKey, publishPdesProgress
+   publishPdesProgress( worker,
+                           getPdesKey( pdesRun, pdesRun->epochEnd, 0 ) );
+}
+
+/*
+Funtion name: startPdesEpoch
+Algorithm: merges the log lines and counters of the last epoch, then moves
+           the run clock to the balance tick at or before the next event,
+           boosts the MLFQ levels if due, balances the cores there and sets
+           the epoch to end one tick on
+Precondition: all workers are waiting at the barrier
+Postcondiditon: epoch is set up, or the done flag is set
+Exceptions: none
+Note: the first epoch starts at the run clock, time zero
+*/
+void startPdesEpoch( PdesRun *pdesRun, Boolean firstEpoch )
+{
+   // initialize variables
+   SimContext *simContext = pdesRun->simContext;
+   int nextMSec = simContext->simMSec;
+
+   // check for an epoch to merge
+   if( firstEpoch == False )
+   {
+      // function: mergePdesLogs
+      mergePdesLogs( pdesRun );
+
+      // find the next event, the run clock is at the last epoch start
+         // function: findNextSmpTime
+      nextMSec = findNextSmpTime( simContext, pdesRun->balanceMS );
+
+      // check for no event left
+      if( nextMSec < 0 )
+      {
+         pdesRun->doneFlag = True;
+
+         return;
+      }
+
+      nextMSec = ( nextMSec / pdesRun->balanceMS ) * pdesRun->balanceMS;
+   }
+
+   // run the clock up to the epoch start
+      // function: runTimer
+   runTimer( &simContext->timer, nextMSec - simContext->simMSec );
+   simContext->simMSec = nextMSec;
+
+   // check for the MLFQ priority boost
+   if( nextMSec == simContext->nextBoostMSec )
+   {
+      // function: boostSmpLevels
+      boostSmpLevels( simContext, pdesRun->balanceMS );
+   }
+
+   // the epoch starts on a balance tick
+      // function: balanceSmpCores
+   balanceSmpCores( simContext );
+
+   pdesRun->epochStart = nextMSec;
+   pdesRun->epochEnd = nextMSec + pdesRun->balanceMS;
+}
+
+/*
+Funtion name: mergePdesLogs
+Algorithm: moves the log lines of every worker to the run context in
+           ( time, core ) order, taking the lowest keyed segment each time,
+           then adds the workers' state counters to the run context
+Precondition: all workers are waiting at the barrier
+Postcondiditon: worker log lists and counters are empty
+Exceptions: none
+Note: lines are printed and kept as the run context's log option says
+*/
+void mergePdesLogs( PdesRun *pdesRun )
+{
+   // initialize variables
+   SimContext *simContext = pdesRun->simContext;
+   PdesWorker *worker;
+   PdesWorker *nextWorker;
+   int workerIndex;
+   int *segmentIndexArray;
+   fileOutputBuffer **lineArray;
+   fileOutputBuffer *localLine;
+   fileOutputBuffer *segmentEnd;
+   Boolean printLines = False;
+   Boolean keepLines = False;
+
+   // check the log option of the run
+   if( simContext->quietFlag == False
+       && ( simContext->loggingFormatFlag == LOGTO_MONITOR_CODE ||
+            simContext->loggingFormatFlag == LOGTO_BOTH_CODE ) )
+   {
+      printLines = True;
+   }
+
+   if( simContext->loggingFormatFlag == LOGTO_FILE_CODE ||
+         simContext->loggingFormatFlag == LOGTO_BOTH_CODE )
+   {
+      keepLines = True;
+   }
+
+   // start each worker at its first segment and first line
+      // function: malloc
+   segmentIndexArray = (int *)malloc( sizeof( int ) * pdesRun->workerCount );
+   lineArray = (fileOutputBuffer **)malloc(
+                        sizeof( fileOutputBuffer * ) * pdesRun->workerCount );
+   workerIndex = 0;
+
+   while( workerIndex < pdesRun->workerCount )
+   {
+      segmentIndexArray[ workerIndex ] = 0;
+      lineArray[ workerIndex ] = pdesRun->workerArray[ workerIndex ]
+                                        .shadowContext.logListHead->nextNode;
+      workerIndex++;
+   }
+
+   // loop until every segment is moved
+   do
+   {
+      // find the worker with the lowest next segment key
+      nextWorker = NULL;
+      workerIndex = 0;
+
+      while( workerIndex < pdesRun->workerCount )
+      {
+         worker = &pdesRun->workerArray[ workerIndex ];
+
+         if( segmentIndexArray[ workerIndex ] < worker->segmentCount
+             && ( nextWorker == NULL
+                  || worker->segmentKeys[ segmentIndexArray[ workerIndex ] ]
+                  < nextWorker->segmentKeys[
+                         segmentIndexArray[ nextWorker->workerIndex ] ] ) )
+         {
+            nextWorker = worker;
+         }
+
+         workerIndex++;
+      }
+
+      // check for a segment to move
+      if( nextWorker != NULL )
+      {
+         workerIndex = nextWorker->workerIndex;
+         segmentEnd = nextWorker->segmentEnds[
+                                             segmentIndexArray[ workerIndex ] ];
+
+         // loop through the lines of the segment
+         localLine = lineArray[ workerIndex ];
+         lineArray[ workerIndex ] = segmentEnd->nextNode;
+         segmentEnd->nextNode = NULL;
+
+         while( localLine != NULL )
+         {
+            // check for the monitor
+            if( printLines == True )
+            {
+               printf( "%s", localLine->lineString );
+            }
+
+            // check for the log file
+            if( keepLines == True )
+            {
+               // link the line to the end of the run's list
+               simContext->logListTail->nextNode = localLine;
+               simContext->logListTail = localLine;
+               localLine = localLine->nextNode;
+            }
+            // otherwise, the line is done
+            else
+            {
+               segmentEnd = localLine->nextNode;
+
+                  // function: free
+               free( localLine );
+
+               localLine = segmentEnd;
+            }
+         }
+
+         segmentIndexArray[ workerIndex ]++;
+      }
+   } while( nextWorker != NULL );
+
+   // empty the workers and add their counters to the run
+   workerIndex = 0;
+
+   while( workerIndex < pdesRun->workerCount )
+   {
+      worker = &pdesRun->workerArray[ workerIndex ];
+
+      worker->shadowContext.logListHead->nextNode = NULL;
+      worker->shadowContext.logListTail = worker->shadowContext.logListHead;
+      worker->segmentCount = 0;
+
+      simContext->exitCount = simContext->exitCount
+                                        + worker->shadowContext.exitCount;
+      simContext->blockedCount = simContext->blockedCount
+                                     + worker->shadowContext.blockedCount;
+      simContext->segFaultCount = simContext->segFaultCount
+                                    + worker->shadowContext.segFaultCount;
+      worker->shadowContext.exitCount = 0;
+      worker->shadowContext.blockedCount = 0;
+      worker->shadowContext.segFaultCount = 0;
+
+      workerIndex++;
+   }
+
+      // function: free
+   free( segmentIndexArray );
+   free( lineArray );
+}
+
+/*
+Funtion name: recordPdesSegment
+Algorithm: marks the worker's last log line as the end of the lines with
+           the given key, growing the segment arrays as needed
+Precondition: new lines were logged under the key
+Postcondiditon: segment is recorded
+Exceptions: none
+Note: none
+*/
+void recordPdesSegment( PdesWorker *worker, long long segmentKey )
+{
+   // check for full arrays
+   if( worker->segmentCount == worker->segmentCapacity )
+   {
+      // double the capacity, starting at 64
+      worker->segmentCapacity = worker->segmentCapacity * 2;
+
+      if( worker->segmentCapacity == 0 )
+      {
+         worker->segmentCapacity = 64;
+      }
+
+         // function: realloc
+      worker->segmentKeys = (long long *)realloc( worker->segmentKeys,
+                            sizeof( long long ) * worker->segmentCapacity );
+      worker->segmentEnds = (fileOutputBuffer **)realloc(
+                                 worker->segmentEnds,
+               sizeof( fileOutputBuffer * ) * worker->segmentCapacity );
+   }
+
+   worker->segmentKeys[ worker->segmentCount ] = segmentKey;
+   worker->segmentEnds[ worker->segmentCount ] =
+                                      worker->shadowContext.logListTail;
+   worker->segmentCount++;
+}
+
+/*
+Funtion name: findWorkerNextTime
+Algorithm: returns the earliest slice end or IO completion of the
+           worker's cores
+Precondition: none
+Postcondiditon: returns the next event time, -1 if none
+Exceptions: none
+Note: balance ticks are left to the epochs
+*/
+int findWorkerNextTime( PdesWorker *worker )
+{
+   // initialize variables
+   SimContext *shadowContext = &worker->shadowContext;
+   int nextMSec = -1;
+   int coreIndex = worker->workerIndex;
+   SimCore *core;
+   PCB *nextEvent;
+
+   // loop through the worker's cores
+   while( coreIndex < shadowContext->coreCount )
+   {
+      core = &shadowContext->coreArray[ coreIndex ];
+
+      // check for a running slice
+      if( core->runningPCB != NULL
+           && ( nextMSec < 0 || core->sliceEnd < nextMSec ) )
+      {
+         nextMSec = core->sliceEnd;
+      }
+
+      // check for a blocked process
+         // function: peekHeapNode
+      nextEvent = peekHeapNode( &core->eventHeap );
+
+      if( nextEvent != NULL
+           && ( nextMSec < 0 || nextEvent->ioDeadline < nextMSec ) )
+      {
+         nextMSec = nextEvent->ioDeadline;
+      }
+
+      coreIndex = coreIndex + worker->pdesRun->workerCount;
+   }
+
+   return nextMSec;
+}
+
+/*
+Funtion name: getPdesKey
+Algorithm: orders events by time, then by core
+Precondition: core id is below the core count
+Postcondiditon: returns the key
+Exceptions: none
+Note: none
+*/
+long long getPdesKey( PdesRun *pdesRun, int simMSec, int coreId )
+{
+   return (long long) simMSec * pdesRun->simContext->coreCount + coreId;
+}
+
+/*
+Funtion name: enterSharedEvent
+Algorithm: for a worker's shadow context, waits until every other worker
+           has published a key past the current ( time, core ), so no
+           event ordered before this one is still to run anywhere
+Precondition: given the context the core's events run in
+Postcondiditon: returns the context holding the shared memory blocks
+Exceptions: none
+Note: returns the given context when the run is not parallel
+*/
+SimContext *enterSharedEvent( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   PdesWorker *worker = simContext->pdesWorker;
+   PdesRun *pdesRun;
+   long long eventKey;
+   int workerIndex = 0;
+
+   // check for a run that is not parallel
+   if( worker == NULL )
+   {
+      return simContext;
+   }
+
+   pdesRun = worker->pdesRun;
+
+   // function: getPdesKey
+   eventKey = getPdesKey( pdesRun, simContext->simMSec, core->coreId );
+
+   // wait for each other worker to pass the key
+   while( workerIndex < pdesRun->workerCount )
+   {
+      if( workerIndex != worker->workerIndex )
+      {
+         // function: waitPdesProgress
+         waitPdesProgress( pdesRun, &pdesRun->workerArray[ workerIndex ],
+                                                                  eventKey );
+      }
+
+      workerIndex++;
+   }
+
+   return pdesRun->simContext;
+}
+
+/*
+Funtion name: publishPdesProgress
+Algorithm: stores the worker's new progress key, then wakes the waiting
+           workers if there are any
+Precondition: key is not below the worker's last key
+Postcondiditon: shared events ordered before the key may run
+Exceptions: none
+Note: the key is stored before the waiting count is read, and a waiting
+      worker raises the count before it reads the key, so a wakeup is
+      never lost
+*/
+void publishPdesProgress( PdesWorker *worker, long long progressKey )
+{
+   // initialize variables
+   PdesRun *pdesRun = worker->pdesRun;
+
+   // function: __atomic_store_n
+   __atomic_store_n( &worker->progressKey, progressKey, __ATOMIC_SEQ_CST );
+
+   // check for a waiting worker
+      // function: __atomic_load_n
+   if( __atomic_load_n( &pdesRun->waitingCount, __ATOMIC_SEQ_CST ) > 0 )
+   {
+      // function: pthread_mutex_lock, pthread_cond_broadcast
+      pthread_mutex_lock( &pdesRun->progressMutex );
+      pthread_cond_broadcast( &pdesRun->progressCondition );
+      pthread_mutex_unlock( &pdesRun->progressMutex );
+   }
+}
+
+/*
+Funtion name: waitPdesProgress
+Algorithm: sleeps on the progress condition until the other worker has
+           published a key past the event's key
+Precondition: other worker is not the calling worker
+Postcondiditon: the other worker has no event left ordered before the key
+Exceptions: none
+Note: returns at once when the key is already passed
+*/
+void waitPdesProgress( PdesRun *pdesRun, PdesWorker *otherWorker,
+                                                       long long eventKey )
+{
+   // check for a key already passed
+      // function: __atomic_load_n
+   if( __atomic_load_n( &otherWorker->progressKey, __ATOMIC_ACQUIRE )
+                                                                > eventKey )
+   {
+      return;
+   }
+
+   // sleep until the key is passed
+      // function: pthread_mutex_lock, __atomic_add_fetch,
+      //           pthread_cond_wait, __atomic_sub_fetch
+   pthread_mutex_lock( &pdesRun->progressMutex );
+
+   __atomic_add_fetch( &pdesRun->waitingCount, 1, __ATOMIC_SEQ_CST );
+
+   while( __atomic_load_n( &otherWorker->progressKey, __ATOMIC_SEQ_CST )
+                                                               <= eventKey )
+   {
+      pthread_cond_wait( &pdesRun->progressCondition,
+                                                  &pdesRun->progressMutex );
+   }
+
+   __atomic_sub_fetch( &pdesRun->waitingCount, 1, __ATOMIC_SEQ_CST );
+
+   pthread_mutex_unlock( &pdesRun->progressMutex );
+}
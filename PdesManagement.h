@@ -0,0 +1,77 @@
+// Pre-compiler directive
+#ifndef PDES_MANAGEMENT_H
+#define PDES_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include <pthread.h>
+#include "StringUtils.h"
+#include "simulator.h"
+
+// one host thread of a parallel run, owning every core whose id mod the
+//    worker count is its index
+typedef struct PdesWorker
+{
+   // index of the worker and its thread
+   int workerIndex;
+   pthread_t thread;
+
+   // shadow of the run context with the worker's own clock, log list and
+   //    state counters; the shared memory blocks stay in the run context
+   SimContext shadowContext;
+   struct PdesRun *pdesRun;
+
+   // ( time, core ) key of the next event the worker may run, every shared
+   //    event of the worker has a key at least this large
+   long long progressKey;
+
+   // last time the worker stepped to
+   int lastMSec;
+
+   // log lines of the current epoch, split at the end of each ( time, core )
+   long long *segmentKeys;
+   fileOutputBuffer **segmentEnds;
+   int segmentCount;
+   int segmentCapacity;
+} PdesWorker;
+
+// state shared by the workers of a parallel run
+typedef struct PdesRun
+{
+   // run context and its workers
+   SimContext *simContext;
+   PdesWorker *workerArray;
+   int workerCount;
+
+   // current epoch; each epoch is one balance tick long
+   int balanceMS;
+   int epochStart;
+   int epochEnd;
+   Boolean doneFlag;
+
+   // workers meet here before and after each epoch
+   pthread_barrier_t epochBarrier;
+
+   // workers waiting on another worker's progress key, and their wakeup
+   //    whenever a key is published
+   int waitingCount;
+   pthread_mutex_t progressMutex;
+   pthread_cond_t progressCondition;
+} PdesRun;
+
+// function prototypes
+void runPdesSim( SimContext *simContext, int workerCount, int balanceMS );
+void *runPdesWorker( void *workerPtr );
+void runPdesEpoch( PdesWorker *worker );
+void startPdesEpoch( PdesRun *pdesRun, Boolean firstEpoch );
+void mergePdesLogs( PdesRun *pdesRun );
+void recordPdesSegment( PdesWorker *worker, long long segmentKey );
+int findWorkerNextTime( PdesWorker *worker );
+long long getPdesKey( PdesRun *pdesRun, int simMSec, int coreId );
+void publishPdesProgress( PdesWorker *worker, long long progressKey );
+void waitPdesProgress( PdesRun *pdesRun, PdesWorker *otherWorker,
+                                                      long long eventKey );
+SimContext *enterSharedEvent( SimContext *simContext, SimCore *core );
+
+#endif   // PDES_MANAGEMENT_H
@@ -0,0 +1,1778 @@
+#include "QueueManagement.h"
+#include "SchedManagement.h"
+#include "DeviceManagement.h"
+#include "MemoryManagement.h"
+
+// global constants
+const int WHEEL_ZERO_BITS = 8;
+const int WHEEL_LEVEL_BITS = 6;
+
+/*
+Funtion name: setPcbState
+Algorithm: moves a PCB from the queue of its current state to the queue
+           of the new state and keeps the state counters current
+Precondition: PCB is in the queue matching its state ( or is NEW )
+Postcondiditon: PCB state is set, PCB is in the matching queue
+Exceptions: none
+Note: READY uses the ready queue, BLOCKED and NEW ( before arrival ) use
+      the event queue ( or a device wait list ), RUNNING is a single
+      pointer, EXIT is only counted and gives the process's memory back
+*/
+void setPcbState( SimContext *simContext, PCB *pcb, pcbStateCodes newState )
+{
+   // check for no change
+   if( pcb->processState == newState )
+   {
+      return;
+   }
+
+   // take the PCB out of its current queue
+   switch( pcb->processState )
+   {
+      case PCB_READY_STATE:
+
+         // function: removeReadyNode
+         removeReadyNode( simContext, pcb );
+         simContext->readyCount--;
+
+         break;
+
+      case PCB_BLOCKED_STATE:
+
+         // the op is done, its device channel serves the next request
+            // function: removeEventNode, releaseDevice
+         removeEventNode( simContext, pcb );
+         releaseDevice( simContext, pcb );
+         simContext->blockedCount--;
+
+         break;
+
+      case PCB_RUNNING_STATE:
+
+         simContext->runningPCB = NULL;
+
+         break;
+
+      case PCB_EXIT_STATE:
+
+         simContext->exitCount--;
+
+         break;
+
+      case PCB_NEW_STATE:
+
+         // a process waiting to arrive is on the event queue
+            // function: removeEventNode
+         removeEventNode( simContext, pcb );
+
+         break;
+   }
+
+   // put the PCB in the new queue
+   switch( newState )
+   {
+      case PCB_READY_STATE:
+
+         // function: addReadyNode
+         addReadyNode( simContext, pcb );
+         simContext->readyCount++;
+
+         break;
+
+      case PCB_BLOCKED_STATE:
+
+         // the device starts the IO op now, or queues it
+            // function: requestDevice
+         requestDevice( simContext, pcb );
+         simContext->blockedCount++;
+
+         break;
+
+      case PCB_RUNNING_STATE:
+
+         simContext->runningPCB = pcb;
+
+         // keep the time of the first run
+         if( pcb->firstRunMSec < 0 )
+         {
+            pcb->firstRunMSec = simContext->simMSec;
+         }
+
+         break;
+
+      case PCB_EXIT_STATE:
+
+         // give its memory back
+            // function: releaseMemory
+         releaseMemory( simContext, pcb );
+
+         simContext->exitCount++;
+         pcb->exitReached = True;
+         pcb->exitMSec = simContext->simMSec;
+
+         break;
+
+      case PCB_NEW_STATE:
+         break;
+   }
+
+   // set the new state
+   pcb->processState = newState;
+}
+
+/*
+Funtion name: addReadyNode
+Algorithm: adds a PCB to the ready queue of the run's scheduler
+Precondition: PCB is not in the ready queue
+Postcondiditon: PCB is in the ready queue
+Exceptions: none
+Note: none
+*/
+void addReadyNode( SimContext *simContext, PCB *newNode )
+{
+   // function: enqueuePcb
+   simContext->schedOps->enqueuePcb( &simContext->readyQueue, newNode );
+}
+
+/*
+Funtion name: removeReadyNode
+Algorithm: removes a PCB from the ready queue of the run's scheduler
+Precondition: PCB is in the ready queue
+Postcondiditon: PCB is out of the ready queue
+Exceptions: none
+Note: none
+*/
+void removeReadyNode( SimContext *simContext, PCB *oldNode )
+{
+   // function: removePcb
+   simContext->schedOps->removePcb( &simContext->readyQueue, oldNode );
+}
+
+/*
+Funtion name: peekReadyNode
+Algorithm: returns the PCB the run's scheduler runs next
+Precondition: none
+Postcondiditon: ready queue is unchanged
+Exceptions: none
+Note: returns null if no PCB is ready
+*/
+PCB *peekReadyNode( SimContext *simContext )
+{
+   // function: peekNextPcb
+   return simContext->schedOps->peekNextPcb( &simContext->readyQueue );
+}
+
+/*
+Funtion name: addEventNode
+Algorithm: adds a blocked PCB to the event heap, or to the timing wheel
+           when the config selects it
+Precondition: PCB IO deadline is set, PCB is not in the event queue
+Postcondiditon: PCB is in the event queue
+Exceptions: none
+Note: none
+*/
+void addEventNode( SimContext *simContext, PCB *newNode )
+{
+   // check for the timing wheel
+   if( simContext->configPtr->ioTimerCode == IO_TIMER_WHEEL_CODE )
+   {
+      // function: addWheelNode
+      addWheelNode( &simContext->eventWheel, newNode );
+   }
+   // otherwise, assume the event heap
+   else
+   {
+      // function: addHeapNode
+      addHeapNode( &simContext->eventHeap, newNode );
+   }
+}
+
+/*
+Funtion name: removeEventNode
+Algorithm: removes a PCB from the event heap or the timing wheel
+Precondition: none
+Postcondiditon: PCB is out of the event queue
+Exceptions: none
+Note: a PCB already taken as due is in neither, and is left alone
+*/
+void removeEventNode( SimContext *simContext, PCB *oldNode )
+{
+   // check for the PCB in the wheel
+   if( oldNode->wheelSlot >= 0 )
+   {
+      // function: removeWheelNode
+      removeWheelNode( &simContext->eventWheel, oldNode );
+   }
+   // otherwise, check for the PCB in the heap
+   else if( oldNode->heapIndex >= 0 )
+   {
+      // function: removeHeapNode
+      removeHeapNode( &simContext->eventHeap, oldNode );
+   }
+}
+
+/*
+Funtion name: peekEventNode
+Algorithm: returns a PCB holding the earliest IO deadline
+Precondition: none
+Postcondiditon: event queue is unchanged
+Exceptions: none
+Note: returns null if no PCB is blocked
+*/
+PCB *peekEventNode( SimContext *simContext )
+{
+   // check for the timing wheel
+   if( simContext->configPtr->ioTimerCode == IO_TIMER_WHEEL_CODE )
+   {
+      // function: peekWheelNode
+      return peekWheelNode( &simContext->eventWheel );
+   }
+
+   // otherwise, return the top of the event heap
+      // function: peekHeapNode
+   return peekHeapNode( &simContext->eventHeap );
+}
+
+/*
+Funtion name: takeDueEventNode
+Algorithm: removes and returns the next PCB whose IO deadline has been
+           reached, in deadline then pid order
+Precondition: no deadline was passed without its PCB being taken
+Postcondiditon: returned PCB is out of the event queue, still BLOCKED
+Exceptions: none
+Note: returns null once no PCB is due
+*/
+PCB *takeDueEventNode( SimContext *simContext )
+{
+   // initialize variables
+   PCB *dueNode;
+
+   // check for the timing wheel
+   if( simContext->configPtr->ioTimerCode == IO_TIMER_WHEEL_CODE )
+   {
+      // function: takeDueWheelNode
+      return takeDueWheelNode( &simContext->eventWheel,
+                                                     simContext->simMSec );
+   }
+
+   // otherwise, check the top of the event heap
+      // function: peekHeapNode
+   dueNode = peekHeapNode( &simContext->eventHeap );
+
+   if( dueNode == NULL || dueNode->ioDeadline > simContext->simMSec )
+   {
+      return NULL;
+   }
+
+   // function: removeHeapNode
+   removeHeapNode( &simContext->eventHeap, dueNode );
+
+   return dueNode;
+}
+
+/*
+Funtion name: initRing
+Algorithm: sets up an empty PCB ring
+Precondition: none
+Postcondiditon: ring is empty, no array is allocated until first use
+Exceptions: none
+Note: none
+*/
+void initRing( PcbRing *ring )
+{
+   ring->ringArray = NULL;
+   ring->ringHead = 0;
+   ring->ringSize = 0;
+   ring->ringCapacity = 0;
+}
+
+/*
+Funtion name: clearRing
+Algorithm: returns the ring array to the OS
+Precondition: ring was set up by initRing
+Postcondiditon: ring is empty
+Exceptions: none
+Note: the PCBs themselves are owned by the PCB list
+*/
+void clearRing( PcbRing *ring )
+{
+   // function: free
+   free( ring->ringArray );
+
+   // function: initRing
+   initRing( ring );
+}
+
+/*
+Funtion name: addRingNode
+Algorithm: places the PCB after the ring tail, doubling the array (and
+           unwrapping it) when it is full
+Precondition: PCB is not in the ring
+Postcondiditon: PCB is the ring tail
+Exceptions: none
+Note: assumes memory access/availability
+*/
+void addRingNode( PcbRing *ring, PCB *newNode )
+{
+   // initialize variables
+   PCB **newArray;
+   int newCapacity;
+   int ringIndex;
+
+   // check for a full array
+   if( ring->ringSize == ring->ringCapacity )
+   {
+      // double the capacity, starting small
+      newCapacity = 16;
+
+      if( ring->ringCapacity > 0 )
+      {
+         newCapacity = ring->ringCapacity * 2;
+      }
+
+      // copy the ring to the new array, head first
+         // function: malloc, free
+      newArray = (PCB **)malloc( sizeof( PCB * ) * newCapacity );
+
+      ringIndex = 0;
+
+      while( ringIndex < ring->ringSize )
+      {
+         newArray[ ringIndex ] = ring->ringArray[
+                     ( ring->ringHead + ringIndex ) % ring->ringCapacity ];
+         ringIndex++;
+      }
+
+      free( ring->ringArray );
+
+      ring->ringArray = newArray;
+      ring->ringHead = 0;
+      ring->ringCapacity = newCapacity;
+   }
+
+   // place the PCB after the tail
+   ring->ringArray[ ( ring->ringHead + ring->ringSize )
+                                          % ring->ringCapacity ] = newNode;
+   ring->ringSize++;
+}
+
+/*
+Funtion name: removeRingNode
+Algorithm: removes the PCB from the ring; the head and tail are removed
+           directly, any other PCB closes the gap behind it
+Precondition: PCB is in the ring
+Postcondiditon: PCB is out of the ring, order of the rest is kept
+Exceptions: none
+Note: the scheduler only removes the head, or the tail while it runs
+*/
+void removeRingNode( PcbRing *ring, PCB *oldNode )
+{
+   // initialize variables
+   int ringIndex = ring->ringSize - 1;
+
+   // check for the head
+   if( ring->ringArray[ ring->ringHead ] == oldNode )
+   {
+      // move the head forward
+      ring->ringHead = ( ring->ringHead + 1 ) % ring->ringCapacity;
+      ring->ringSize--;
+
+      return;
+   }
+
+   // find the PCB searching back from the tail
+   while( ring->ringArray[ ( ring->ringHead + ringIndex )
+                                     % ring->ringCapacity ] != oldNode )
+   {
+      ringIndex--;
+   }
+
+   // move the PCBs behind it forward by one
+   while( ringIndex < ring->ringSize - 1 )
+   {
+      ring->ringArray[ ( ring->ringHead + ringIndex ) % ring->ringCapacity ]
+         = ring->ringArray[ ( ring->ringHead + ringIndex + 1 )
+                                                   % ring->ringCapacity ];
+      ringIndex++;
+   }
+
+   ring->ringSize--;
+}
+
+/*
+Funtion name: peekRingNode
+Algorithm: returns the ring head
+Precondition: none
+Postcondiditon: ring is unchanged
+Exceptions: none
+Note: returns null for an empty ring
+*/
+PCB *peekRingNode( PcbRing *ring )
+{
+   // check for an empty ring
+   if( ring->ringSize == 0 )
+   {
+      return NULL;
+   }
+
+   // return the head
+   return ring->ringArray[ ring->ringHead ];
+}
+
+/*
+Funtion name: peekRingTail
+Algorithm: returns the ring tail
+Precondition: ring is not empty
+Postcondiditon: ring is unchanged
+Exceptions: none
+Note: none
+*/
+PCB *peekRingTail( PcbRing *ring )
+{
+   return ring->ringArray[ ( ring->ringHead + ring->ringSize - 1 )
+                                                   % ring->ringCapacity ];
+}
+
+/*
+Funtion name: initTree
+Algorithm: sets up an empty PCB tree with the given ordering
+Precondition: none
+Postcondiditon: tree is empty
+Exceptions: none
+Note: the tree links live in the PCBs, so nothing is allocated
+*/
+void initTree( PcbTree *tree, PcbBefore nodeBefore )
+{
+   tree->treeRoot = NULL;
+   tree->leftmostNode = NULL;
+   tree->treeSize = 0;
+   tree->nodeBefore = nodeBefore;
+}
+
+/*
+Funtion name: addTreeNode
+Algorithm: walks down from the root to the leaf where the PCB belongs,
+           links it there as a red node and restores the red-black rules
+Precondition: PCB is not in the tree
+Postcondiditon: PCB is in the tree, the leftmost node is current
+Exceptions: none
+Note: none
+*/
+void addTreeNode( PcbTree *tree, PCB *newNode )
+{
+   // initialize variables
+   PCB *parentNode = NULL;
+   PCB *cursorNode = tree->treeRoot;
+   Boolean leftmostFlag = True;
+
+   // find the leaf for the new PCB
+      // function: nodeBefore
+   while( cursorNode != NULL )
+   {
+      parentNode = cursorNode;
+
+      if( tree->nodeBefore( newNode, cursorNode ) == True )
+      {
+         cursorNode = cursorNode->treeLeft;
+      }
+      else
+      {
+         cursorNode = cursorNode->treeRight;
+         leftmostFlag = False;
+      }
+   }
+
+   // link the new PCB as a red leaf
+   newNode->treeParent = parentNode;
+   newNode->treeLeft = NULL;
+   newNode->treeRight = NULL;
+   newNode->treeRedFlag = True;
+
+   if( parentNode == NULL )
+   {
+      tree->treeRoot = newNode;
+   }
+   else if( tree->nodeBefore( newNode, parentNode ) == True )
+   {
+      parentNode->treeLeft = newNode;
+   }
+   else
+   {
+      parentNode->treeRight = newNode;
+   }
+
+   // check for a new leftmost node
+   if( leftmostFlag == True )
+   {
+      tree->leftmostNode = newNode;
+   }
+
+   tree->treeSize++;
+
+   // function: fixTreeInsert
+   fixTreeInsert( tree, newNode );
+}
+
+/*
+Funtion name: removeTreeNode
+Algorithm: unlinks the PCB, moving its successor into its place when it
+           has two children, and restores the red-black rules when a black
+           node left the tree
+Precondition: PCB is in the tree
+Postcondiditon: PCB is out of the tree, the leftmost node is current
+Exceptions: none
+Note: the leftmost node has no left child, so its successor is the least
+      node of its right subtree or else its parent
+*/
+void removeTreeNode( PcbTree *tree, PCB *oldNode )
+{
+   // initialize variables
+   PCB *nextNode;
+   PCB *childNode;
+   PCB *childParent;
+   Boolean removedRedFlag = oldNode->treeRedFlag;
+
+   // check for the leftmost node leaving
+   if( oldNode == tree->leftmostNode )
+   {
+      if( oldNode->treeRight != NULL )
+      {
+         // function: findTreeMin
+         tree->leftmostNode = findTreeMin( oldNode->treeRight );
+      }
+      else
+      {
+         tree->leftmostNode = oldNode->treeParent;
+      }
+   }
+
+   // check for at most one child
+      // function: replaceTreeNode
+   if( oldNode->treeLeft == NULL )
+   {
+      childNode = oldNode->treeRight;
+      childParent = oldNode->treeParent;
+      replaceTreeNode( tree, oldNode, childNode );
+   }
+   else if( oldNode->treeRight == NULL )
+   {
+      childNode = oldNode->treeLeft;
+      childParent = oldNode->treeParent;
+      replaceTreeNode( tree, oldNode, childNode );
+   }
+   // otherwise, move the successor into the old place
+   else
+   {
+      // function: findTreeMin
+      nextNode = findTreeMin( oldNode->treeRight );
+      removedRedFlag = nextNode->treeRedFlag;
+      childNode = nextNode->treeRight;
+
+      if( nextNode->treeParent == oldNode )
+      {
+         childParent = nextNode;
+      }
+      else
+      {
+         childParent = nextNode->treeParent;
+         replaceTreeNode( tree, nextNode, nextNode->treeRight );
+         nextNode->treeRight = oldNode->treeRight;
+         nextNode->treeRight->treeParent = nextNode;
+      }
+
+      replaceTreeNode( tree, oldNode, nextNode );
+      nextNode->treeLeft = oldNode->treeLeft;
+      nextNode->treeLeft->treeParent = nextNode;
+      nextNode->treeRedFlag = oldNode->treeRedFlag;
+   }
+
+   // check for a black node taken out
+   if( removedRedFlag == False )
+   {
+      // function: fixTreeRemove
+      fixTreeRemove( tree, childNode, childParent );
+   }
+
+   // clear the links of the old PCB
+   oldNode->treeLeft = NULL;
+   oldNode->treeRight = NULL;
+   oldNode->treeParent = NULL;
+
+   tree->treeSize--;
+}
+
+/*
+Funtion name: peekTreeNode
+Algorithm: returns the leftmost node, the first in tree order
+Precondition: none
+Postcondiditon: tree is unchanged
+Exceptions: none
+Note: returns null for an empty tree
+*/
+PCB *peekTreeNode( PcbTree *tree )
+{
+   return tree->leftmostNode;
+}
+
+/*
+Funtion name: rotateTreeNode
+Algorithm: rotates the subtree at the pivot left ( its right child moves
+           up ) or right ( its left child moves up )
+Precondition: the child moving up is not null
+Postcondiditon: in order sequence of the tree is unchanged
+Exceptions: none
+Note: none
+*/
+void rotateTreeNode( PcbTree *tree, PCB *pivotNode, Boolean leftFlag )
+{
+   // initialize variables
+   PCB *raisedNode;
+
+   // check for a left rotation
+   if( leftFlag == True )
+   {
+      raisedNode = pivotNode->treeRight;
+      pivotNode->treeRight = raisedNode->treeLeft;
+
+      if( raisedNode->treeLeft != NULL )
+      {
+         raisedNode->treeLeft->treeParent = pivotNode;
+      }
+   }
+   // otherwise, assume a right rotation
+   else
+   {
+      raisedNode = pivotNode->treeLeft;
+      pivotNode->treeLeft = raisedNode->treeRight;
+
+      if( raisedNode->treeRight != NULL )
+      {
+         raisedNode->treeRight->treeParent = pivotNode;
+      }
+   }
+
+   // put the raised node where the pivot was
+      // function: replaceTreeNode
+   replaceTreeNode( tree, pivotNode, raisedNode );
+
+   // hang the pivot under the raised node
+   if( leftFlag == True )
+   {
+      raisedNode->treeLeft = pivotNode;
+   }
+   else
+   {
+      raisedNode->treeRight = pivotNode;
+   }
+
+   pivotNode->treeParent = raisedNode;
+}
+
+/*
+Funtion name: replaceTreeNode
+Algorithm: links the new node ( or null ) to the parent of the old node
+           in the old node's place
+Precondition: old node is in the tree
+Postcondiditon: the children of the new node are unchanged
+Exceptions: none
+Note: none
+*/
+void replaceTreeNode( PcbTree *tree, PCB *oldNode, PCB *newNode )
+{
+   // check for the root
+   if( oldNode->treeParent == NULL )
+   {
+      tree->treeRoot = newNode;
+   }
+   else if( oldNode == oldNode->treeParent->treeLeft )
+   {
+      oldNode->treeParent->treeLeft = newNode;
+   }
+   else
+   {
+      oldNode->treeParent->treeRight = newNode;
+   }
+
+   if( newNode != NULL )
+   {
+      newNode->treeParent = oldNode->treeParent;
+   }
+}
+
+/*
+Funtion name: fixTreeInsert
+Algorithm: while the new red node has a red parent, recolors a red uncle
+           and moves up, or rotates the grandparent once the uncle is black
+Precondition: the node was just linked as a red leaf
+Postcondiditon: no red node has a red child, the root is black
+Exceptions: none
+Note: none
+*/
+void fixTreeInsert( PcbTree *tree, PCB *treeNode )
+{
+   // initialize variables
+   PCB *parentNode;
+   PCB *grandNode;
+   PCB *uncleNode;
+   Boolean leftSideFlag;
+   Boolean rightSideFlag;
+
+   // loop while the parent is red ( a red parent is never the root )
+      // function: isTreeNodeRed
+   while( treeNode != tree->treeRoot
+                          && isTreeNodeRed( treeNode->treeParent ) == True )
+   {
+      parentNode = treeNode->treeParent;
+      grandNode = parentNode->treeParent;
+
+      // find the side of the parent and the uncle across from it
+      if( parentNode == grandNode->treeLeft )
+      {
+         leftSideFlag = True;
+         rightSideFlag = False;
+         uncleNode = grandNode->treeRight;
+      }
+      else
+      {
+         leftSideFlag = False;
+         rightSideFlag = True;
+         uncleNode = grandNode->treeLeft;
+      }
+
+      // check for a red uncle, push the red up to the grandparent
+      if( isTreeNodeRed( uncleNode ) == True )
+      {
+         parentNode->treeRedFlag = False;
+         uncleNode->treeRedFlag = False;
+         grandNode->treeRedFlag = True;
+         treeNode = grandNode;
+      }
+      // otherwise, rotate the red pair over the grandparent
+         // function: rotateTreeNode
+      else
+      {
+         // an inner child is first turned to the outside
+         if( leftSideFlag == True && treeNode == parentNode->treeRight )
+         {
+            treeNode = parentNode;
+            rotateTreeNode( tree, treeNode, True );
+            parentNode = treeNode->treeParent;
+         }
+         else if( leftSideFlag == False
+                                    && treeNode == parentNode->treeLeft )
+         {
+            treeNode = parentNode;
+            rotateTreeNode( tree, treeNode, False );
+            parentNode = treeNode->treeParent;
+         }
+
+         parentNode->treeRedFlag = False;
+         grandNode->treeRedFlag = True;
+         rotateTreeNode( tree, grandNode, rightSideFlag );
+      }
+   }
+   // end loop
+
+   tree->treeRoot->treeRedFlag = False;
+}
+
+/*
+Funtion name: fixTreeRemove
+Algorithm: the node holds an extra black; while it is black and not the
+           root, rotates a red sibling away, then either recolors a sibling
+           with black children and moves up, or rotates the sibling's red
+           child over to end the loop
+Precondition: a black node was taken from the parent's side of the node,
+              the node may be null
+Postcondiditon: every root to leaf path has the same black count
+Exceptions: none
+Note: the parent is passed since a null node has no link to it
+*/
+void fixTreeRemove( PcbTree *tree, PCB *treeNode, PCB *parentNode )
+{
+   // initialize variables
+   PCB *siblingNode;
+   PCB *nearNode;
+   PCB *farNode;
+   Boolean leftSideFlag;
+   Boolean rightSideFlag;
+
+   // loop while the extra black sits on a black non root node
+      // function: isTreeNodeRed, rotateTreeNode
+   while( treeNode != tree->treeRoot && isTreeNodeRed( treeNode ) == False )
+   {
+      // find the side of the node and the sibling across from it
+      if( treeNode == parentNode->treeLeft )
+      {
+         leftSideFlag = True;
+         rightSideFlag = False;
+         siblingNode = parentNode->treeRight;
+      }
+      else
+      {
+         leftSideFlag = False;
+         rightSideFlag = True;
+         siblingNode = parentNode->treeLeft;
+      }
+
+      // check for a red sibling, rotate it over the parent
+      if( siblingNode->treeRedFlag == True )
+      {
+         siblingNode->treeRedFlag = False;
+         parentNode->treeRedFlag = True;
+         rotateTreeNode( tree, parentNode, leftSideFlag );
+
+         if( leftSideFlag == True )
+         {
+            siblingNode = parentNode->treeRight;
+         }
+         else
+         {
+            siblingNode = parentNode->treeLeft;
+         }
+      }
+
+      // find the children of the sibling nearest and farthest from the node
+      if( leftSideFlag == True )
+      {
+         nearNode = siblingNode->treeLeft;
+         farNode = siblingNode->treeRight;
+      }
+      else
+      {
+         nearNode = siblingNode->treeRight;
+         farNode = siblingNode->treeLeft;
+      }
+
+      // check for a sibling with black children, move the black up
+      if( isTreeNodeRed( nearNode ) == False
+                                    && isTreeNodeRed( farNode ) == False )
+      {
+         siblingNode->treeRedFlag = True;
+         treeNode = parentNode;
+         parentNode = treeNode->treeParent;
+      }
+      // otherwise, rotate a red child of the sibling over
+      else
+      {
+         // a red near child is first turned to the far side
+         if( isTreeNodeRed( farNode ) == False )
+         {
+            nearNode->treeRedFlag = False;
+            siblingNode->treeRedFlag = True;
+            rotateTreeNode( tree, siblingNode, rightSideFlag );
+
+            if( leftSideFlag == True )
+            {
+               siblingNode = parentNode->treeRight;
+               farNode = siblingNode->treeRight;
+            }
+            else
+            {
+               siblingNode = parentNode->treeLeft;
+               farNode = siblingNode->treeLeft;
+            }
+         }
+
+         siblingNode->treeRedFlag = parentNode->treeRedFlag;
+         parentNode->treeRedFlag = False;
+         farNode->treeRedFlag = False;
+         rotateTreeNode( tree, parentNode, leftSideFlag );
+
+         // the extra black is gone
+         treeNode = tree->treeRoot;
+      }
+   }
+   // end loop
+
+   if( treeNode != NULL )
+   {
+      treeNode->treeRedFlag = False;
+   }
+}
+
+/*
+Funtion name: isTreeNodeRed
+Algorithm: returns the color of a node, null leaves are black
+Precondition: none
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+Boolean isTreeNodeRed( PCB *treeNode )
+{
+   if( treeNode == NULL )
+   {
+      return False;
+   }
+
+   return treeNode->treeRedFlag;
+}
+
+/*
+Funtion name: findTreeMin
+Algorithm: follows left links down from the node
+Precondition: node is not null
+Postcondiditon: returns the least node of the subtree
+Exceptions: none
+Note: none
+*/
+PCB *findTreeMin( PCB *treeNode )
+{
+   while( treeNode->treeLeft != NULL )
+   {
+      treeNode = treeNode->treeLeft;
+   }
+
+   return treeNode;
+}
+
+/*
+Funtion name: initHeap
+Algorithm: sets up an empty PCB heap with the given ordering
+Precondition: none
+Postcondiditon: heap is empty, no array is allocated until first use
+Exceptions: none
+Note: none
+*/
+void initHeap( PcbHeap *heap, PcbBefore nodeBefore )
+{
+   heap->heapArray = NULL;
+   heap->heapSize = 0;
+   heap->heapCapacity = 0;
+   heap->nodeBefore = nodeBefore;
+}
+
+/*
+Funtion name: clearHeap
+Algorithm: returns the heap array to the OS
+Precondition: heap was set up by initHeap
+Postcondiditon: heap is empty
+Exceptions: none
+Note: the PCBs themselves are owned by the PCB list
+*/
+void clearHeap( PcbHeap *heap )
+{
+   // function: free
+   free( heap->heapArray );
+
+   heap->heapArray = NULL;
+   heap->heapSize = 0;
+   heap->heapCapacity = 0;
+}
+
+/*
+Funtion name: addHeapNode
+Algorithm: places the PCB at the end of the heap and sifts it up,
+           doubling the array when it is full
+Precondition: PCB is not in a heap
+Postcondiditon: PCB is in the heap, its heap index is set
+Exceptions: none
+Note: assumes memory access/availability
+*/
+void addHeapNode( PcbHeap *heap, PCB *newNode )
+{
+   // check for a full array
+   if( heap->heapSize == heap->heapCapacity )
+   {
+      // double the capacity, starting small
+      if( heap->heapCapacity == 0 )
+      {
+         heap->heapCapacity = 16;
+      }
+      else
+      {
+         heap->heapCapacity *= 2;
+      }
+
+      // function: realloc
+      heap->heapArray = (PCB **)realloc( heap->heapArray,
+                                     sizeof( PCB * ) * heap->heapCapacity );
+   }
+
+   // place the PCB at the end
+   heap->heapArray[ heap->heapSize ] = newNode;
+   newNode->heapIndex = heap->heapSize;
+   heap->heapSize++;
+
+   // restore the heap order
+      // function: siftHeapUp
+   siftHeapUp( heap, newNode->heapIndex );
+}
+
+/*
+Funtion name: removeHeapNode
+Algorithm: moves the last PCB into the removed PCB's place and sifts it
+           in whichever direction restores the heap order
+Precondition: PCB is in the given heap
+Postcondiditon: PCB is out of the heap, its heap index is -1
+Exceptions: none
+Note: none
+*/
+void removeHeapNode( PcbHeap *heap, PCB *oldNode )
+{
+   // initialize variables
+   int heapIndex = oldNode->heapIndex;
+   PCB *lastNode;
+
+   // take the last PCB off the end
+   heap->heapSize--;
+   lastNode = heap->heapArray[ heap->heapSize ];
+
+   // check for the removed PCB not being the last
+   if( lastNode != oldNode )
+   {
+      // move the last PCB into the gap
+      heap->heapArray[ heapIndex ] = lastNode;
+      lastNode->heapIndex = heapIndex;
+
+      // restore the heap order
+         // function: siftHeapUp, siftHeapDown
+      siftHeapUp( heap, heapIndex );
+      siftHeapDown( heap, lastNode->heapIndex );
+   }
+
+   // PCB is no longer in the heap
+   oldNode->heapIndex = -1;
+}
+
+/*
+Funtion name: peekHeapNode
+Algorithm: returns the first PCB in heap order
+Precondition: none
+Postcondiditon: heap is unchanged
+Exceptions: none
+Note: returns null for an empty heap
+*/
+PCB *peekHeapNode( PcbHeap *heap )
+{
+   // check for an empty heap
+   if( heap->heapSize == 0 )
+   {
+      return NULL;
+   }
+
+   // return the top of the heap
+   return heap->heapArray[ 0 ];
+}
+
+/*
+Funtion name: pidPcbBefore
+Algorithm: compares two PCBs by pid
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB has the lower pid
+Exceptions: none
+Note: every ordering breaks its ties here, which keeps the order of the
+      old list scans
+*/
+Boolean pidPcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // lower pid first
+   if( onePCB->pid < otherPCB->pid )
+   {
+      return True;
+   }
+
+   return False;
+}
+
+/*
+Funtion name: deadlinePcbBefore
+Algorithm: compares two PCBs by IO deadline, ties go to the lower pid
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: the ordering of the event heaps
+*/
+Boolean deadlinePcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // earliest IO completion first
+   if( onePCB->ioDeadline < otherPCB->ioDeadline )
+   {
+      return True;
+   }
+
+   if( onePCB->ioDeadline > otherPCB->ioDeadline )
+   {
+      return False;
+   }
+
+   // function: pidPcbBefore
+   return pidPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: siftHeapUp
+Algorithm: swaps the PCB at the index with its parent until the parent
+           comes first
+Precondition: index is inside the heap
+Postcondiditon: heap order holds from the index to the top
+Exceptions: none
+Note: none
+*/
+void siftHeapUp( PcbHeap *heap, int heapIndex )
+{
+   // initialize variables
+   PCB *movingNode = heap->heapArray[ heapIndex ];
+   int parentIndex;
+
+   // loop while the moving PCB comes before its parent
+   while( heapIndex > 0 )
+   {
+      parentIndex = ( heapIndex - 1 ) / 2;
+
+      // check for the parent coming first
+         // function: nodeBefore
+      if( heap->nodeBefore( movingNode,
+                              heap->heapArray[ parentIndex ] ) == False )
+      {
+         break;
+      }
+
+      // move the parent down
+      heap->heapArray[ heapIndex ] = heap->heapArray[ parentIndex ];
+      heap->heapArray[ heapIndex ]->heapIndex = heapIndex;
+
+      heapIndex = parentIndex;
+   }
+
+   // place the moving PCB
+   heap->heapArray[ heapIndex ] = movingNode;
+   movingNode->heapIndex = heapIndex;
+}
+
+/*
+Funtion name: siftHeapDown
+Algorithm: swaps the PCB at the index with its first child until it comes
+           before both children
+Precondition: index is inside the heap
+Postcondiditon: heap order holds from the index down
+Exceptions: none
+Note: none
+*/
+void siftHeapDown( PcbHeap *heap, int heapIndex )
+{
+   // initialize variables
+   PCB *movingNode = heap->heapArray[ heapIndex ];
+   int childIndex;
+
+   // loop while the PCB has a child
+   while( 2 * heapIndex + 1 < heap->heapSize )
+   {
+      // find the child that comes first
+      childIndex = 2 * heapIndex + 1;
+
+         // function: nodeBefore
+      if( childIndex + 1 < heap->heapSize
+          && heap->nodeBefore( heap->heapArray[ childIndex + 1 ],
+                                  heap->heapArray[ childIndex ] ) == True )
+      {
+         childIndex++;
+      }
+
+      // check for the moving PCB coming first
+      if( heap->nodeBefore( heap->heapArray[ childIndex ],
+                                                     movingNode ) == False )
+      {
+         break;
+      }
+
+      // move the child up
+      heap->heapArray[ heapIndex ] = heap->heapArray[ childIndex ];
+      heap->heapArray[ heapIndex ]->heapIndex = heapIndex;
+
+      heapIndex = childIndex;
+   }
+
+   // place the moving PCB
+   heap->heapArray[ heapIndex ] = movingNode;
+   movingNode->heapIndex = heapIndex;
+}
+
+/*
+Funtion name: initWheel
+Algorithm: sets up an empty timing wheel at time zero
+Precondition: none
+Postcondiditon: every slot is empty
+Exceptions: none
+Note: none
+*/
+void initWheel( TimingWheel *wheel )
+{
+   // initialize variables
+   int slotIndex = 0;
+
+   wheel->wheelMSec = 0;
+
+   // empty the slot lists
+   while( slotIndex < WHEEL_SLOT_COUNT )
+   {
+      wheel->slotArray[ slotIndex ] = NULL;
+      slotIndex++;
+   }
+
+   // clear the occupancy bits
+   slotIndex = 0;
+
+   while( slotIndex < WHEEL_OVERFLOW_SLOT / 64 )
+   {
+      wheel->slotBitmap[ slotIndex ] = 0;
+      slotIndex++;
+   }
+}
+
+/*
+Funtion name: addWheelNode
+Algorithm: hashes the PCB IO deadline to a slot; deadlines within a turn
+           of level zero go in their ms slot, later ones in the slot of
+           the lowest upper level whose turn reaches them
+Precondition: PCB is not in the wheel, its deadline is not before the
+              wheel time
+Postcondiditon: PCB is in the wheel
+Exceptions: none
+Note: deadlines past the top level wait in the overflow list
+*/
+void addWheelNode( TimingWheel *wheel, PCB *newNode )
+{
+   // initialize variables
+   int deadline = newNode->ioDeadline;
+   int msAhead = deadline - wheel->wheelMSec;
+   int levelShift = WHEEL_ZERO_BITS;
+   int levelBase = WHEEL_ZERO_SLOTS;
+   int slotIndex = WHEEL_OVERFLOW_SLOT;
+
+   // check for a deadline inside the level zero turn
+   if( msAhead < WHEEL_ZERO_SLOTS )
+   {
+      slotIndex = deadline & ( WHEEL_ZERO_SLOTS - 1 );
+   }
+
+   // otherwise, find the first upper level whose turn reaches it
+   while( slotIndex == WHEEL_OVERFLOW_SLOT && levelBase < WHEEL_OVERFLOW_SLOT )
+   {
+      // check for the deadline inside this level's turn
+      if( ( msAhead >> ( levelShift + WHEEL_LEVEL_BITS ) ) == 0 )
+      {
+         slotIndex = levelBase
+               + ( ( deadline >> levelShift ) & ( WHEEL_LEVEL_SLOTS - 1 ) );
+      }
+
+      levelShift = levelShift + WHEEL_LEVEL_BITS;
+      levelBase = levelBase + WHEEL_LEVEL_SLOTS;
+   }
+
+   // function: linkWheelNode
+   linkWheelNode( wheel, newNode, slotIndex );
+}
+
+/*
+Funtion name: linkWheelNode
+Algorithm: pushes the PCB on the front of the slot list and marks the
+           slot as holding a PCB
+Precondition: PCB is not in the wheel
+Postcondiditon: PCB is in the slot list
+Exceptions: none
+Note: the overflow and due lists have no occupancy bit
+*/
+void linkWheelNode( TimingWheel *wheel, PCB *newNode, int slotIndex )
+{
+   // link the PCB in front of the slot list
+   newNode->prevEvent = NULL;
+   newNode->nextEvent = wheel->slotArray[ slotIndex ];
+
+   if( newNode->nextEvent != NULL )
+   {
+      newNode->nextEvent->prevEvent = newNode;
+   }
+
+   wheel->slotArray[ slotIndex ] = newNode;
+   newNode->wheelSlot = slotIndex;
+
+   // check for a level slot
+   if( slotIndex < WHEEL_OVERFLOW_SLOT )
+   {
+      // set its occupancy bit
+      wheel->slotBitmap[ slotIndex / 64 ] |= 1ULL << ( slotIndex % 64 );
+   }
+}
+
+/*
+Funtion name: removeWheelNode
+Algorithm: unlinks the PCB from its slot list, clearing the occupancy bit
+           of a level slot it leaves empty
+Precondition: PCB is in the wheel
+Postcondiditon: PCB is out of the wheel, its slot is -1
+Exceptions: none
+Note: none
+*/
+void removeWheelNode( TimingWheel *wheel, PCB *oldNode )
+{
+   // initialize variables
+   int slotIndex = oldNode->wheelSlot;
+
+   // unlink the PCB from its neighbors or the slot head
+   if( oldNode->prevEvent != NULL )
+   {
+      oldNode->prevEvent->nextEvent = oldNode->nextEvent;
+   }
+   else
+   {
+      wheel->slotArray[ slotIndex ] = oldNode->nextEvent;
+   }
+
+   if( oldNode->nextEvent != NULL )
+   {
+      oldNode->nextEvent->prevEvent = oldNode->prevEvent;
+   }
+
+   // check for an emptied level slot
+   if( wheel->slotArray[ slotIndex ] == NULL
+                                     && slotIndex < WHEEL_OVERFLOW_SLOT )
+   {
+      // clear its occupancy bit
+      wheel->slotBitmap[ slotIndex / 64 ] &= ~( 1ULL << ( slotIndex % 64 ) );
+   }
+
+   // PCB is no longer in the wheel
+   oldNode->nextEvent = NULL;
+   oldNode->prevEvent = NULL;
+   oldNode->wheelSlot = -1;
+}
+
+/*
+Funtion name: findWheelSlot
+Algorithm: scans the occupancy bits of one level a word at a time,
+           starting at the given slot and wrapping around the level
+Precondition: level base and slot count are multiples of 64
+Postcondiditon: returns how many slots past the start the first
+                occupied slot is, or -1 if the level is empty
+Exceptions: none
+Note: none
+*/
+int findWheelSlot( TimingWheel *wheel, int levelBase, int slotCount,
+                                                             int startSlot )
+{
+   // initialize variables
+   int wordCount = slotCount / 64;
+   int startWord = startSlot / 64;
+   int startBit = startSlot % 64;
+   int wordStep = 0;
+   int wordIndex;
+   int slotIndex;
+   unsigned long long slotBits;
+
+   // loop over the words from the start, then back to the start word
+   while( wordStep <= wordCount )
+   {
+      wordIndex = ( startWord + wordStep ) % wordCount;
+      slotBits = wheel->slotBitmap[ levelBase / 64 + wordIndex ];
+
+      // check for the start word, first pass skips the slots before it
+      if( wordStep == 0 )
+      {
+         slotBits = slotBits & ( ~0ULL << startBit );
+      }
+      // check for the start word again, last pass keeps only those slots
+      else if( wordStep == wordCount )
+      {
+         slotBits = slotBits & ( ( 1ULL << startBit ) - 1 );
+      }
+
+      // check for an occupied slot
+      if( slotBits != 0 )
+      {
+         // function: __builtin_ctzll
+         slotIndex = wordIndex * 64 + __builtin_ctzll( slotBits );
+
+         return ( slotIndex - startSlot + slotCount ) % slotCount;
+      }
+
+      wordStep++;
+   }
+
+   // level is empty
+   return -1;
+}
+
+/*
+Funtion name: peekWheelNode
+Algorithm: takes the first occupied level zero slot, then checks the
+           first occupied slot of each upper level (and the overflow
+           list) for an earlier deadline
+Precondition: none
+Postcondiditon: wheel is unchanged
+Exceptions: none
+Note: an upper slot is only scanned when its turn starts before the
+      best deadline found so far, returns null for an empty wheel
+*/
+PCB *peekWheelNode( TimingWheel *wheel )
+{
+   // initialize variables
+   int wheelMSec = wheel->wheelMSec;
+   int levelShift = WHEEL_ZERO_BITS;
+   int levelBase = WHEEL_ZERO_SLOTS;
+   int slotOffset;
+   int levelTurn;
+   PCB *bestNode = NULL;
+   PCB *localPtr;
+
+   // check for PCBs already taken as due
+   if( wheel->slotArray[ WHEEL_DUE_SLOT ] != NULL )
+   {
+      return wheel->slotArray[ WHEEL_DUE_SLOT ];
+   }
+
+   // find the first occupied level zero slot, all its PCBs share a deadline
+      // function: findWheelSlot
+   slotOffset = findWheelSlot( wheel, 0, WHEEL_ZERO_SLOTS,
+                                  wheelMSec & ( WHEEL_ZERO_SLOTS - 1 ) );
+
+   if( slotOffset >= 0 )
+   {
+      bestNode = wheel->slotArray[
+                     ( wheelMSec + slotOffset ) & ( WHEEL_ZERO_SLOTS - 1 ) ];
+   }
+
+   // loop over the upper levels
+   while( levelBase < WHEEL_OVERFLOW_SLOT )
+   {
+      // find the first occupied slot after the current one
+         // function: findWheelSlot
+      levelTurn = ( wheelMSec >> levelShift ) + 1;
+      slotOffset = findWheelSlot( wheel, levelBase, WHEEL_LEVEL_SLOTS,
+                                    levelTurn & ( WHEEL_LEVEL_SLOTS - 1 ) );
+
+      // check for a slot whose turn starts before the best deadline
+      if( slotOffset >= 0 && ( bestNode == NULL
+         || ( ( levelTurn + slotOffset ) << levelShift )
+                                                <= bestNode->ioDeadline ) )
+      {
+         // scan the slot for an earlier deadline
+         localPtr = wheel->slotArray[ levelBase
+               + ( ( levelTurn + slotOffset ) & ( WHEEL_LEVEL_SLOTS - 1 ) ) ];
+
+         while( localPtr != NULL )
+         {
+            if( bestNode == NULL || localPtr->ioDeadline < bestNode->ioDeadline )
+            {
+               bestNode = localPtr;
+            }
+
+            localPtr = localPtr->nextEvent;
+         }
+      }
+
+      levelShift = levelShift + WHEEL_LEVEL_BITS;
+      levelBase = levelBase + WHEEL_LEVEL_SLOTS;
+   }
+
+   // scan the overflow list
+   localPtr = wheel->slotArray[ WHEEL_OVERFLOW_SLOT ];
+
+   while( localPtr != NULL )
+   {
+      if( bestNode == NULL || localPtr->ioDeadline < bestNode->ioDeadline )
+      {
+         bestNode = localPtr;
+      }
+
+      localPtr = localPtr->nextEvent;
+   }
+
+   // return the earliest PCB
+   return bestNode;
+}
+
+/*
+Funtion name: turnWheel
+Algorithm: moves the wheel time forward; each time level zero starts a
+           new turn, the next slot of each upper level that turns with it
+           (highest first) is emptied and its PCBs hashed again
+Precondition: no PCB deadline lies before the new time
+Postcondiditon: wheel time is the new time, every PCB due within a level
+                zero turn is in its ms slot
+Exceptions: none
+Note: with nothing above level zero the wheel jumps straight to the time
+*/
+void turnWheel( TimingWheel *wheel, int newMSec )
+{
+   // initialize variables
+   int levelShift;
+   int levelBase;
+   int nextTurn;
+
+   // loop until the wheel reaches the new time
+   while( wheel->wheelMSec < newMSec )
+   {
+      // find the start of the next level zero turn
+      nextTurn = ( wheel->wheelMSec | ( WHEEL_ZERO_SLOTS - 1 ) ) + 1;
+
+      // check for the new time inside this turn, or nothing to cascade
+      if( newMSec < nextTurn
+          || ( wheel->slotBitmap[ WHEEL_ZERO_SLOTS / 64 ] == 0
+               && wheel->slotBitmap[ WHEEL_ZERO_SLOTS / 64 + 1 ] == 0
+               && wheel->slotBitmap[ WHEEL_ZERO_SLOTS / 64 + 2 ] == 0
+               && wheel->slotArray[ WHEEL_OVERFLOW_SLOT ] == NULL ) )
+      {
+         wheel->wheelMSec = newMSec;
+      }
+      // otherwise, start the next turn
+      else
+      {
+         wheel->wheelMSec = nextTurn;
+
+         // check for the top level starting a new turn
+         if( ( nextTurn >> ( WHEEL_ZERO_BITS + 3 * WHEEL_LEVEL_BITS ) )
+                 << ( WHEEL_ZERO_BITS + 3 * WHEEL_LEVEL_BITS ) == nextTurn )
+         {
+            // hash the overflow list again
+               // function: cascadeWheelSlot
+            cascadeWheelSlot( wheel, WHEEL_OVERFLOW_SLOT );
+         }
+
+         // loop down the upper levels that start a new slot
+         levelShift = WHEEL_ZERO_BITS + 2 * WHEEL_LEVEL_BITS;
+         levelBase = WHEEL_OVERFLOW_SLOT - WHEEL_LEVEL_SLOTS;
+
+         while( levelBase >= WHEEL_ZERO_SLOTS )
+         {
+            // check for the level starting a new slot
+            if( ( nextTurn >> levelShift ) << levelShift == nextTurn )
+            {
+               // hash the slot's PCBs again
+                  // function: cascadeWheelSlot
+               cascadeWheelSlot( wheel, levelBase
+                  + ( ( nextTurn >> levelShift ) & ( WHEEL_LEVEL_SLOTS - 1 ) ) );
+            }
+
+            levelShift = levelShift - WHEEL_LEVEL_BITS;
+            levelBase = levelBase - WHEEL_LEVEL_SLOTS;
+         }
+      }
+   }
+}
+
+/*
+Funtion name: cascadeWheelSlot
+Algorithm: empties one slot list and adds each of its PCBs to the wheel
+           again at the current wheel time
+Precondition: none
+Postcondiditon: slot PCBs are in lower slots (or the same list, for an
+                overflow deadline still out of reach)
+Exceptions: none
+Note: none
+*/
+void cascadeWheelSlot( TimingWheel *wheel, int slotIndex )
+{
+   // initialize variables
+   PCB *localPtr = wheel->slotArray[ slotIndex ];
+   PCB *nextPtr;
+
+   // empty the slot
+   wheel->slotArray[ slotIndex ] = NULL;
+
+   if( slotIndex < WHEEL_OVERFLOW_SLOT )
+   {
+      wheel->slotBitmap[ slotIndex / 64 ] &= ~( 1ULL << ( slotIndex % 64 ) );
+   }
+
+   // loop across the old slot list
+   while( localPtr != NULL )
+   {
+      nextPtr = localPtr->nextEvent;
+
+      // function: addWheelNode
+      localPtr->wheelSlot = -1;
+      addWheelNode( wheel, localPtr );
+
+      localPtr = nextPtr;
+   }
+}
+
+/*
+Funtion name: takeDueWheelNode
+Algorithm: once the due list is empty, turns the wheel to the simulated
+           time and moves that ms slot, sorted by pid, to the due list;
+           then removes the first PCB of the due list
+Precondition: no PCB deadline lies before the simulated time
+Postcondiditon: returned PCB is out of the wheel
+Exceptions: none
+Note: every completion of one ms expires as one batch,
+      returns null once the batch is used up
+*/
+PCB *takeDueWheelNode( TimingWheel *wheel, int simMSec )
+{
+   // initialize variables
+   int slotIndex = simMSec & ( WHEEL_ZERO_SLOTS - 1 );
+   PCB *dueNode;
+   PCB *localPtr;
+
+   // check for an empty due list
+   if( wheel->slotArray[ WHEEL_DUE_SLOT ] == NULL )
+   {
+      // bring the wheel up to the simulated time
+         // function: turnWheel
+      turnWheel( wheel, simMSec );
+
+      // move the slot of this ms to the due list in pid order
+         // function: sortEventList
+      localPtr = sortEventList( wheel->slotArray[ slotIndex ] );
+      wheel->slotArray[ slotIndex ] = NULL;
+      wheel->slotBitmap[ slotIndex / 64 ] &= ~( 1ULL << ( slotIndex % 64 ) );
+
+      wheel->slotArray[ WHEEL_DUE_SLOT ] = localPtr;
+
+      while( localPtr != NULL )
+      {
+         localPtr->wheelSlot = WHEEL_DUE_SLOT;
+
+         if( localPtr->nextEvent != NULL )
+         {
+            localPtr->nextEvent->prevEvent = localPtr;
+         }
+
+         localPtr = localPtr->nextEvent;
+      }
+
+      // the head has no previous PCB
+      if( wheel->slotArray[ WHEEL_DUE_SLOT ] != NULL )
+      {
+         wheel->slotArray[ WHEEL_DUE_SLOT ]->prevEvent = NULL;
+      }
+   }
+
+   // take the first due PCB
+   dueNode = wheel->slotArray[ WHEEL_DUE_SLOT ];
+
+   if( dueNode != NULL )
+   {
+      // function: removeWheelNode
+      removeWheelNode( wheel, dueNode );
+   }
+
+   return dueNode;
+}
+
+/*
+Funtion name: sortEventList
+Algorithm: merge sorts a list linked by its next event links, by pid
+Precondition: none
+Postcondiditon: returns the head of the sorted list,
+                previous event links are not set
+Exceptions: none
+Note: none
+*/
+PCB *sortEventList( PCB *listHead )
+{
+   // initialize variables
+   PCB *slowPtr = listHead;
+   PCB *fastPtr;
+   PCB *otherHead;
+   PCB **linkPtr = &listHead;
+
+   // check for a list of zero or one PCBs
+   if( listHead == NULL || listHead->nextEvent == NULL )
+   {
+      return listHead;
+   }
+
+   // split the list in half
+   fastPtr = listHead->nextEvent;
+
+   while( fastPtr != NULL && fastPtr->nextEvent != NULL )
+   {
+      slowPtr = slowPtr->nextEvent;
+      fastPtr = fastPtr->nextEvent->nextEvent;
+   }
+
+   otherHead = slowPtr->nextEvent;
+   slowPtr->nextEvent = NULL;
+
+   // sort both halves
+      // function: sortEventList
+   listHead = sortEventList( listHead );
+   otherHead = sortEventList( otherHead );
+
+   // merge the halves, lower pid first
+   while( *linkPtr != NULL && otherHead != NULL )
+   {
+      // check for the other half coming first
+      if( otherHead->pid < (*linkPtr)->pid )
+      {
+         // move the other half's head in front
+         fastPtr = otherHead;
+         otherHead = otherHead->nextEvent;
+         fastPtr->nextEvent = *linkPtr;
+         *linkPtr = fastPtr;
+      }
+
+      linkPtr = &(*linkPtr)->nextEvent;
+   }
+
+   // append what is left of the other half
+   if( otherHead != NULL )
+   {
+      *linkPtr = otherHead;
+   }
+
+   return listHead;
+}
+
+/*
+Funtion name: queueFinishedPcb
+Algorithm: adds a PCB whose current op code is app end to the pid
+           ordered list of PCBs waiting to be set to EXIT
+Precondition: none
+Postcondiditon: PCB is queued once, if it has reached app end
+Exceptions: none
+Note: called wherever a PCB moves to its next op code
+*/
+void queueFinishedPcb( SimContext *simContext, PCB *pcb )
+{
+   // initialize variables
+   PCB **linkPtr = &simContext->finishListHead;
+
+   // check for a PCB at app end that is not already queued
+      // function: compareString
+   if( pcb->finishPending == False && pcb->processState != PCB_EXIT_STATE
+       && compareString( pcb->currentOpCode->command, "app" ) == STR_EQ
+       && compareString( pcb->currentOpCode->strArg1, "end" ) == STR_EQ )
+   {
+      // find the pid ordered place in the list
+      while( *linkPtr != NULL && (*linkPtr)->pid < pcb->pid )
+      {
+         linkPtr = &(*linkPtr)->nextFinish;
+      }
+
+      // link the PCB in
+      pcb->nextFinish = *linkPtr;
+      *linkPtr = pcb;
+      pcb->finishPending = True;
+   }
+}
+
+/*
+Funtion name: takeFinishedPcb
+Algorithm: removes the lowest pid PCB waiting to be set to EXIT
+Precondition: none
+Postcondiditon: returns the PCB, or null if none are waiting
+Exceptions: none
+Note: none
+*/
+PCB *takeFinishedPcb( SimContext *simContext )
+{
+   // initialize variables
+   PCB *finishedPCB = simContext->finishListHead;
+
+   // check for a waiting PCB
+   if( finishedPCB != NULL )
+   {
+      // unlink it
+      simContext->finishListHead = finishedPCB->nextFinish;
+      finishedPCB->nextFinish = NULL;
+      finishedPCB->finishPending = False;
+   }
+
+   // return the PCB
+   return finishedPCB;
+}
@@ -0,0 +1,59 @@
+// Pre-compiler directive
+#ifndef QUEUE_MANAGEMENT_H
+#define QUEUE_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include "StringUtils.h"
+#include "simulator.h"
+
+// function prototypes
+void setPcbState( SimContext *simContext, PCB *pcb, pcbStateCodes newState );
+void addReadyNode( SimContext *simContext, PCB *newNode );
+void removeReadyNode( SimContext *simContext, PCB *oldNode );
+PCB *peekReadyNode( SimContext *simContext );
+void addEventNode( SimContext *simContext, PCB *newNode );
+void removeEventNode( SimContext *simContext, PCB *oldNode );
+PCB *peekEventNode( SimContext *simContext );
+PCB *takeDueEventNode( SimContext *simContext );
+void initRing( PcbRing *ring );
+void clearRing( PcbRing *ring );
+void addRingNode( PcbRing *ring, PCB *newNode );
+void removeRingNode( PcbRing *ring, PCB *oldNode );
+PCB *peekRingNode( PcbRing *ring );
+PCB *peekRingTail( PcbRing *ring );
+void initTree( PcbTree *tree, PcbBefore nodeBefore );
+void addTreeNode( PcbTree *tree, PCB *newNode );
+void removeTreeNode( PcbTree *tree, PCB *oldNode );
+PCB *peekTreeNode( PcbTree *tree );
+void rotateTreeNode( PcbTree *tree, PCB *pivotNode, Boolean leftFlag );
+void replaceTreeNode( PcbTree *tree, PCB *oldNode, PCB *newNode );
+void fixTreeInsert( PcbTree *tree, PCB *treeNode );
+void fixTreeRemove( PcbTree *tree, PCB *treeNode, PCB *parentNode );
+Boolean isTreeNodeRed( PCB *treeNode );
+PCB *findTreeMin( PCB *treeNode );
+void initHeap( PcbHeap *heap, PcbBefore nodeBefore );
+void clearHeap( PcbHeap *heap );
+void addHeapNode( PcbHeap *heap, PCB *newNode );
+void removeHeapNode( PcbHeap *heap, PCB *oldNode );
+PCB *peekHeapNode( PcbHeap *heap );
+Boolean pidPcbBefore( PCB *onePCB, PCB *otherPCB );
+Boolean deadlinePcbBefore( PCB *onePCB, PCB *otherPCB );
+void siftHeapUp( PcbHeap *heap, int heapIndex );
+void siftHeapDown( PcbHeap *heap, int heapIndex );
+void initWheel( TimingWheel *wheel );
+void addWheelNode( TimingWheel *wheel, PCB *newNode );
+void linkWheelNode( TimingWheel *wheel, PCB *newNode, int slotIndex );
+void removeWheelNode( TimingWheel *wheel, PCB *oldNode );
+int findWheelSlot( TimingWheel *wheel, int levelBase, int slotCount,
+                                                             int startSlot );
+PCB *peekWheelNode( TimingWheel *wheel );
+void turnWheel( TimingWheel *wheel, int newMSec );
+void cascadeWheelSlot( TimingWheel *wheel, int slotIndex );
+PCB *takeDueWheelNode( TimingWheel *wheel, int simMSec );
+PCB *sortEventList( PCB *listHead );
+void queueFinishedPcb( SimContext *simContext, PCB *pcb );
+PCB *takeFinishedPcb( SimContext *simContext );
+
+#endif   // QUEUE_MANAGEMENT_H
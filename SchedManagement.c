@@ -0,0 +1,1045 @@
+#include "SchedManagement.h"
+#include "QueueManagement.h"
+
+// global constants
+// registry of the scheduling policies, in config code order; a new policy
+//    needs only its functions, its ordering and an entry before the end
+//    marker
+const SchedulerOps SCHEDULER_REGISTRY[] =
+{
+   { "SJF-N", False, msLeftPcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { "SRTF-P", True, msLeftPcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { "FCFS-P", True, pidPcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { "RR-P", True, dispatchPcbBefore,
+     initRoundRobinQueue, clearRoundRobinQueue,
+     enqueueRoundRobinPcb, removeRoundRobinPcb, peekRoundRobinPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { "FCFS-N", False, pidPcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { "MLFQ-P", True, levelPcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getLevelSliceMS,
+     NULL, lowerPcbLevel, raisePcbLevel, NULL, resetPcbLevel, NULL },
+
+   { "CFS-P", True, fairPcbBefore,
+     initFairQueue, clearFairQueue,
+     enqueueFairPcb, removeFairPcb, peekFairPcb,
+     getFairSliceMS,
+     advanceMinVruntime, NULL, NULL, placeWokenPcb, NULL,
+     moveStolenVruntime },
+
+   { "EDF-P", True, duePcbBefore,
+     initHeapQueue, clearHeapQueue,
+     enqueueHeapPcb, removeHeapPcb, peekHeapPcb,
+     getQuantumSliceMS,
+     NULL, NULL, NULL, NULL, NULL, NULL },
+
+   { NULL, False, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+     NULL, NULL, NULL, NULL, NULL, NULL }
+};
+
+/*
+Funtion name: getScheduler
+Algorithm: returns the registry entry of the config code
+Precondition: none
+Postcondiditon: none
+Exceptions: an unknown code gets FCFS-N, as the config default
+Note: none
+*/
+const SchedulerOps *getScheduler( int schedCode )
+{
+   // initialize variables
+   int schedIndex = 0;
+
+   // loop through the registry to the code
+   while( SCHEDULER_REGISTRY[ schedIndex ].schedName != NULL )
+   {
+      if( schedIndex == schedCode )
+      {
+         return &SCHEDULER_REGISTRY[ schedIndex ];
+      }
+
+      schedIndex++;
+   }
+
+   return &SCHEDULER_REGISTRY[ CPU_SCHED_FCFS_N_CODE ];
+}
+
+/*
+Funtion name: findSchedulerCode
+Algorithm: looks a config name up in the registry, ignoring case
+Precondition: none
+Postcondiditon: returns the config code of the policy
+Exceptions: returns -1 for an unknown name
+Note: none
+*/
+int findSchedulerCode( char *schedName )
+{
+   // initialize variables
+   int schedIndex = 0;
+   int strLen = getStringLength( schedName );
+   char *nameStr = (char *)malloc( strLen + 1 );
+   char registryStr[ STD_STR_LEN ];
+
+   // set the name to lower case for testing
+      // function: setStrToLowerCase
+   setStrToLowerCase( nameStr, schedName );
+
+   // loop through the registry
+   while( SCHEDULER_REGISTRY[ schedIndex ].schedName != NULL )
+   {
+      // function: setStrToLowerCase, compareString
+      setStrToLowerCase( registryStr,
+                                 SCHEDULER_REGISTRY[ schedIndex ].schedName );
+
+      if( compareString( nameStr, registryStr ) == STR_EQ )
+      {
+         // function: free
+         free( nameStr );
+
+         return schedIndex;
+      }
+
+      schedIndex++;
+   }
+
+   // function: free
+   free( nameStr );
+
+   return -1;
+}
+
+/*
+Funtion name: getSchedulerName
+Algorithm: returns the config name of the code
+Precondition: none
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+char *getSchedulerName( int schedCode )
+{
+   // function: getScheduler
+   return getScheduler( schedCode )->schedName;
+}
+
+/*
+Funtion name: runSchedEvent
+Algorithm: runs the scheduler's hook for the event, taking a READY process
+           out of the queue around it so its new key is queued in order
+Precondition: PCB is in the given queue if it is READY
+Postcondiditon: PCB is in the same state and queue
+Exceptions: none
+Note: does nothing if the scheduler has no hook for the event
+*/
+void runSchedEvent( SimContext *simContext, ReadyQueue *readyQueue,
+                                    PCB *pcb, schedEventCodes eventCode )
+{
+   // initialize variables
+   const SchedulerOps *schedOps = simContext->schedOps;
+   SchedHook schedHook = NULL;
+
+   // find the hook for the event
+   switch( eventCode )
+   {
+      case SCHED_EVENT_DISPATCH:
+
+         schedHook = schedOps->onDispatch;
+
+         break;
+
+      case SCHED_EVENT_TICK:
+
+         schedHook = schedOps->onTick;
+
+         break;
+
+      case SCHED_EVENT_BLOCK:
+
+         schedHook = schedOps->onBlock;
+
+         break;
+
+      case SCHED_EVENT_WAKE:
+
+         schedHook = schedOps->onWake;
+
+         break;
+
+      case SCHED_EVENT_BOOST:
+
+         schedHook = schedOps->onBoost;
+
+         break;
+   }
+
+   // check for no hook
+   if( schedHook == NULL )
+   {
+      return;
+   }
+
+   // check for a queued process
+   if( pcb->processState == PCB_READY_STATE )
+   {
+      schedOps->removePcb( readyQueue, pcb );
+      schedHook( simContext->configPtr, readyQueue, pcb );
+      schedOps->enqueuePcb( readyQueue, pcb );
+   }
+   else
+   {
+      schedHook( simContext->configPtr, readyQueue, pcb );
+   }
+}
+
+/*
+Funtion name: msLeftPcbBefore
+Algorithm: compares two PCBs by time left, ties go to the lower pid
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: shortest job first
+*/
+Boolean msLeftPcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // shortest time left first
+   if( onePCB->msLeft < otherPCB->msLeft )
+   {
+      return True;
+   }
+
+   if( onePCB->msLeft > otherPCB->msLeft )
+   {
+      return False;
+   }
+
+   // function: pidPcbBefore
+   return pidPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: dispatchPcbBefore
+Algorithm: compares two PCBs by selection stamp, ties go to the lower pid
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: longest wait since last selection first
+*/
+Boolean dispatchPcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // longest wait since last selection first
+   if( onePCB->dispatchStamp < otherPCB->dispatchStamp )
+   {
+      return True;
+   }
+
+   if( onePCB->dispatchStamp > otherPCB->dispatchStamp )
+   {
+      return False;
+   }
+
+   // function: pidPcbBefore
+   return pidPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: levelPcbBefore
+Algorithm: compares two PCBs by MLFQ level, then by selection stamp
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: each level is round robin by its selection stamps
+*/
+Boolean levelPcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // highest MLFQ level first
+   if( onePCB->mlfqLevel < otherPCB->mlfqLevel )
+   {
+      return True;
+   }
+
+   if( onePCB->mlfqLevel > otherPCB->mlfqLevel )
+   {
+      return False;
+   }
+
+   // function: dispatchPcbBefore
+   return dispatchPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: duePcbBefore
+Algorithm: compares two PCBs by absolute deadline, then by selection stamp
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: processes without a deadline run after all that have one
+*/
+Boolean duePcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // a process with a deadline before one without
+   if( onePCB->dueMSec >= 0 && otherPCB->dueMSec < 0 )
+   {
+      return True;
+   }
+
+   if( onePCB->dueMSec < 0 && otherPCB->dueMSec >= 0 )
+   {
+      return False;
+   }
+
+   // then earliest deadline first
+   if( onePCB->dueMSec < otherPCB->dueMSec )
+   {
+      return True;
+   }
+
+   if( onePCB->dueMSec > otherPCB->dueMSec )
+   {
+      return False;
+   }
+
+   // function: dispatchPcbBefore
+   return dispatchPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: fairPcbBefore
+Algorithm: compares two PCBs by virtual runtime, then by selection stamp
+Precondition: both PCBs are valid
+Postcondiditon: returns True if the first PCB comes first
+Exceptions: none
+Note: the stamp keeps equal runtimes first in first out
+*/
+Boolean fairPcbBefore( PCB *onePCB, PCB *otherPCB )
+{
+   // lowest virtual runtime first
+   if( onePCB->vruntime < otherPCB->vruntime )
+   {
+      return True;
+   }
+
+   if( onePCB->vruntime > otherPCB->vruntime )
+   {
+      return False;
+   }
+
+   // function: dispatchPcbBefore
+   return dispatchPcbBefore( onePCB, otherPCB );
+}
+
+/*
+Funtion name: initHeapQueue
+Algorithm: allocates the queue state, a heap in the scheduler's order
+Precondition: none
+Postcondiditon: queue is empty
+Exceptions: none
+Note: assumes memory access/availability
+*/
+void initHeapQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore )
+{
+   // initialize variables
+      // function: malloc
+   HeapQueue *heapQueue = (HeapQueue *)malloc( sizeof( HeapQueue ) );
+
+   // function: initHeap
+   initHeap( &heapQueue->readyHeap, pcbBefore );
+
+   readyQueue->queueState = heapQueue;
+}
+
+/*
+Funtion name: clearHeapQueue
+Algorithm: releases the heap of a queue and its state
+Precondition: queue was set up by initHeapQueue
+Postcondiditon: queue has no state
+Exceptions: none
+Note: none
+*/
+void clearHeapQueue( ReadyQueue *readyQueue )
+{
+   // initialize variables
+   HeapQueue *heapQueue = readyQueue->queueState;
+
+   // function: clearHeap, free
+   clearHeap( &heapQueue->readyHeap );
+   free( heapQueue );
+
+   readyQueue->queueState = NULL;
+}
+
+/*
+Funtion name: enqueueHeapPcb
+Algorithm: adds a PCB to the heap of a queue
+Precondition: PCB is not queued
+Postcondiditon: PCB is in the heap
+Exceptions: none
+Note: none
+*/
+void enqueueHeapPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   HeapQueue *heapQueue = readyQueue->queueState;
+
+   // function: addHeapNode
+   addHeapNode( &heapQueue->readyHeap, pcb );
+}
+
+/*
+Funtion name: removeHeapPcb
+Algorithm: removes a PCB from the heap of a queue
+Precondition: PCB is in the heap
+Postcondiditon: PCB is out of the heap
+Exceptions: none
+Note: none
+*/
+void removeHeapPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   HeapQueue *heapQueue = readyQueue->queueState;
+
+   // function: removeHeapNode
+   removeHeapNode( &heapQueue->readyHeap, pcb );
+}
+
+/*
+Funtion name: peekHeapPcb
+Algorithm: returns the top of the heap of a queue
+Precondition: none
+Postcondiditon: queue is unchanged
+Exceptions: none
+Note: returns null for an empty queue
+*/
+PCB *peekHeapPcb( ReadyQueue *readyQueue )
+{
+   // initialize variables
+   HeapQueue *heapQueue = readyQueue->queueState;
+
+   // function: peekHeapNode
+   return peekHeapNode( &heapQueue->readyHeap );
+}
+
+/*
+Funtion name: initRoundRobinQueue
+Algorithm: allocates the queue state, the ring and a heap in the
+           scheduler's order
+Precondition: given the selection stamp order
+Postcondiditon: queue is empty
+Exceptions: none
+Note: the ring keeps PCBs in dispatch order and the heap only holds
+      unblocked PCBs that waited longer than the ring tail
+*/
+void initRoundRobinQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore )
+{
+   // initialize variables
+      // function: malloc
+   RoundRobinQueue *robinQueue =
+                  (RoundRobinQueue *)malloc( sizeof( RoundRobinQueue ) );
+
+   // function: initHeap, initRing
+   initHeap( &robinQueue->readyHeap, pcbBefore );
+   initRing( &robinQueue->readyRing );
+
+   readyQueue->queueState = robinQueue;
+}
+
+/*
+Funtion name: clearRoundRobinQueue
+Algorithm: releases the ring and the heap of a queue and its state
+Precondition: queue was set up by initRoundRobinQueue
+Postcondiditon: queue has no state
+Exceptions: none
+Note: none
+*/
+void clearRoundRobinQueue( ReadyQueue *readyQueue )
+{
+   // initialize variables
+   RoundRobinQueue *robinQueue = readyQueue->queueState;
+
+   // function: clearHeap, clearRing, free
+   clearHeap( &robinQueue->readyHeap );
+   clearRing( &robinQueue->readyRing );
+   free( robinQueue );
+
+   readyQueue->queueState = NULL;
+}
+
+/*
+Funtion name: enqueueRoundRobinPcb
+Algorithm: a PCB stamped after every PCB in the ring goes on the ring tail,
+           otherwise it goes in the heap
+Precondition: PCB is not queued
+Postcondiditon: PCB is in the ring or the heap
+Exceptions: none
+Note: the ring stays in stamp order, since a preempted process always
+      holds the newest stamp
+*/
+void enqueueRoundRobinPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   RoundRobinQueue *robinQueue = readyQueue->queueState;
+   PcbRing *readyRing = &robinQueue->readyRing;
+
+   // check for a PCB newer than the ring tail
+      // function: peekRingTail
+   if( readyRing->ringSize == 0
+        || peekRingTail( readyRing )->dispatchStamp < pcb->dispatchStamp )
+   {
+      // add to the end of the ring
+         // function: addRingNode
+      addRingNode( readyRing, pcb );
+   }
+   // otherwise, add to the heap
+   else
+   {
+      // function: addHeapNode
+      addHeapNode( &robinQueue->readyHeap, pcb );
+   }
+}
+
+/*
+Funtion name: removeRoundRobinPcb
+Algorithm: removes a PCB from the heap or the ring
+Precondition: PCB is queued
+Postcondiditon: PCB is out of the queue
+Exceptions: none
+Note: none
+*/
+void removeRoundRobinPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   RoundRobinQueue *robinQueue = readyQueue->queueState;
+
+   // check for the PCB in the heap
+   if( pcb->heapIndex >= 0 )
+   {
+      // function: removeHeapNode
+      removeHeapNode( &robinQueue->readyHeap, pcb );
+   }
+   // otherwise, assume it is in the ring
+   else
+   {
+      // function: removeRingNode
+      removeRingNode( &robinQueue->readyRing, pcb );
+   }
+}
+
+/*
+Funtion name: peekRoundRobinPcb
+Algorithm: returns the older of the ring head and the heap top
+Precondition: none
+Postcondiditon: queue is unchanged
+Exceptions: none
+Note: returns null for an empty queue
+*/
+PCB *peekRoundRobinPcb( ReadyQueue *readyQueue )
+{
+   // initialize variables
+   RoundRobinQueue *robinQueue = readyQueue->queueState;
+   PCB *heapNode;
+   PCB *ringNode;
+
+   // find the first PCB of the heap and the ring
+      // function: peekHeapNode, peekRingNode
+   heapNode = peekHeapNode( &robinQueue->readyHeap );
+   ringNode = peekRingNode( &robinQueue->readyRing );
+
+   // check for the ring PCB waiting longer
+   if( ringNode != NULL && ( heapNode == NULL
+                || ringNode->dispatchStamp < heapNode->dispatchStamp ) )
+   {
+      return ringNode;
+   }
+
+   // otherwise, return the heap PCB
+   return heapNode;
+}
+
+/*
+Funtion name: initFairQueue
+Algorithm: allocates the queue state, a tree in the scheduler's order
+Precondition: none
+Postcondiditon: queue is empty, the least runtime is zero
+Exceptions: none
+Note: assumes memory access/availability
+*/
+void initFairQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore )
+{
+   // initialize variables
+      // function: malloc
+   FairQueue *fairQueue = (FairQueue *)malloc( sizeof( FairQueue ) );
+
+   // function: initTree
+   initTree( &fairQueue->readyTree, pcbBefore );
+   fairQueue->minVruntime = 0;
+
+   readyQueue->queueState = fairQueue;
+}
+
+/*
+Funtion name: clearFairQueue
+Algorithm: releases the state of the queue
+Precondition: queue was set up by initFairQueue
+Postcondiditon: queue has no state
+Exceptions: none
+Note: the tree links live in the PCBs, only the state is freed
+*/
+void clearFairQueue( ReadyQueue *readyQueue )
+{
+   // function: free
+   free( readyQueue->queueState );
+
+   readyQueue->queueState = NULL;
+}
+
+/*
+Funtion name: enqueueFairPcb
+Algorithm: adds a PCB to the virtual runtime tree
+Precondition: PCB is not queued
+Postcondiditon: PCB is in the tree
+Exceptions: none
+Note: none
+*/
+void enqueueFairPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   FairQueue *fairQueue = readyQueue->queueState;
+
+   // function: addTreeNode
+   addTreeNode( &fairQueue->readyTree, pcb );
+}
+
+/*
+Funtion name: removeFairPcb
+Algorithm: removes a PCB from the virtual runtime tree
+Precondition: PCB is in the tree
+Postcondiditon: PCB is out of the tree
+Exceptions: none
+Note: none
+*/
+void removeFairPcb( ReadyQueue *readyQueue, PCB *pcb )
+{
+   // initialize variables
+   FairQueue *fairQueue = readyQueue->queueState;
+
+   // function: removeTreeNode
+   removeTreeNode( &fairQueue->readyTree, pcb );
+}
+
+/*
+Funtion name: peekFairPcb
+Algorithm: returns the PCB with the lowest virtual runtime
+Precondition: none
+Postcondiditon: queue is unchanged
+Exceptions: none
+Note: returns null for an empty queue
+*/
+PCB *peekFairPcb( ReadyQueue *readyQueue )
+{
+   // initialize variables
+   FairQueue *fairQueue = readyQueue->queueState;
+
+   // function: peekTreeNode
+   return peekTreeNode( &fairQueue->readyTree );
+}
+
+/*
+Funtion name: getQuantumSliceMS
+Algorithm: returns the config quantum in ms
+Precondition: none
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+int getQuantumSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount )
+{
+   return configPtr->quantumCycles * configPtr->procCycleRate;
+}
+
+/*
+Funtion name: getLevelSliceMS
+Algorithm: returns the quantum of the process's MLFQ level in ms
+Precondition: the level is inside the configured levels
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+int getLevelSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount )
+{
+   return configPtr->mlfqQuantumArray[ pcb->mlfqLevel ]
+                                                  * configPtr->procCycleRate;
+}
+
+/*
+Funtion name: getFairSliceMS
+Algorithm: splits the target latency evenly over the runnable processes,
+           never going below the minimum granularity
+Precondition: runnable count is at least one
+Postcondiditon: returns a slice of at least one ms
+Exceptions: none
+Note: none
+*/
+int getFairSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount )
+{
+   // initialize variables
+   int sliceMS = configPtr->cfsLatencyMS / runnableCount;
+
+   // check for a slice below the granularity
+   if( sliceMS < configPtr->cfsGranularityMS )
+   {
+      sliceMS = configPtr->cfsGranularityMS;
+   }
+
+   // check for no slice at all
+   if( sliceMS < 1 )
+   {
+      sliceMS = 1;
+   }
+
+   return sliceMS;
+}
+
+/*
+Funtion name: lowerPcbLevel
+Algorithm: moves a process that used its whole quantum down one MLFQ
+           level, stopping at the bottom level
+Precondition: PCB is not queued
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+void lowerPcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb )
+{
+   if( pcb->mlfqLevel < configPtr->mlfqLevelCount - 1 )
+   {
+      pcb->mlfqLevel++;
+   }
+}
+
+/*
+Funtion name: raisePcbLevel
+Algorithm: moves a process giving up the cpu for IO up one MLFQ level,
+           stopping at the top level
+Precondition: PCB is not queued
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+void raisePcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb )
+{
+   if( pcb->mlfqLevel > 0 )
+   {
+      pcb->mlfqLevel--;
+   }
+}
+
+/*
+Funtion name: resetPcbLevel
+Algorithm: moves a process back to the top MLFQ level
+Precondition: PCB is not queued
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+void resetPcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb )
+{
+   pcb->mlfqLevel = 0;
+}
+
+/*
+Funtion name: advanceMinVruntime
+Algorithm: moves the least virtual runtime of the queue up to the runtime
+           of the selected process
+Precondition: PCB was the lowest runtime in the queue
+Postcondiditon: none
+Exceptions: none
+Note: the least runtime only moves forward
+*/
+void advanceMinVruntime( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb )
+{
+   // initialize variables
+   FairQueue *fairQueue = readyQueue->queueState;
+
+   if( pcb->vruntime > fairQueue->minVruntime )
+   {
+      fairQueue->minVruntime = pcb->vruntime;
+   }
+}
+
+/*
+Funtion name: placeWokenPcb
+Algorithm: lifts the virtual runtime of a process leaving IO to no less
+           than half a latency behind the least runtime of its queue
+Precondition: PCB is not queued
+Postcondiditon: none
+Exceptions: none
+Note: a long sleeper gets a head start without being able to hold the
+      cpu for long
+*/
+void placeWokenPcb( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb )
+{
+   // initialize variables
+   FairQueue *fairQueue = readyQueue->queueState;
+   int floorVruntime = fairQueue->minVruntime - configPtr->cfsLatencyMS / 2;
+
+   // check for a runtime too far behind
+   if( pcb->vruntime < floorVruntime )
+   {
+      pcb->vruntime = floorVruntime;
+   }
+}
+
+/*
+Funtion name: moveStolenVruntime
+Algorithm: keeps the virtual runtime lead of a stolen process over the
+           least runtime of its queue when it moves to the thief's queue
+Precondition: PCB is queued on neither core
+Postcondiditon: none
+Exceptions: none
+Note: none
+*/
+void moveStolenVruntime( ReadyQueue *fromQueue, ReadyQueue *toQueue,
+                                                                  PCB *pcb )
+{
+   // initialize variables
+   FairQueue *fromState = fromQueue->queueState;
+   FairQueue *toState = toQueue->queueState;
+
+   pcb->vruntime = pcb->vruntime - fromState->minVruntime
+                                                     + toState->minVruntime;
+}
+
+/*
+Funtion name: reportDeadlines
+Algorithm: collects the lateness of every process with a deadline, sorts
+           it for the distribution, sums the cpu load over the deadlines
+           and logs the results
+Precondition: every process is in EXIT
+Postcondiditon: the run's deadline report is filled in and logged
+Exceptions: nothing is logged when no process has a deadline
+Note: the load test is the global EDF density bound, which on one core is
+      the plain sum of cpu time over deadline up to one hundred percent
+*/
+void reportDeadlines( SimContext *simContext )
+{
+   // initialize variables
+   DeadlineReport *report = &simContext->deadlineReport;
+   PCB *localPtr = simContext->pcbListHead;
+   int *latenessArray;
+   int latenessCount = 0;
+   int windowMS, densityPercent, maxDensity = 0;
+   int coreCount = simContext->coreCount;
+
+   // nothing to report yet
+   report->deadlineCount = 0;
+   report->missCount = 0;
+   report->loadPercent = 0;
+   report->schedulableFlag = True;
+
+   // count the processes with a deadline
+   while( localPtr != NULL )
+   {
+      if( localPtr->dueMSec >= 0 )
+      {
+         report->deadlineCount++;
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   // check for no deadlines in the run
+   if( report->deadlineCount == 0 )
+   {
+      return;
+   }
+
+   // function: malloc
+   latenessArray = (int *)malloc( report->deadlineCount * sizeof( int ) );
+
+   // loop across the processes with a deadline
+   localPtr = simContext->pcbListHead;
+
+   while( localPtr != NULL )
+   {
+      if( localPtr->dueMSec >= 0 )
+      {
+         // keep the lateness, counting a miss when it is positive
+         latenessArray[ latenessCount ] = 
+                                    localPtr->exitMSec - localPtr->dueMSec;
+
+         if( latenessArray[ latenessCount ] > 0 )
+         {
+            report->missCount++;
+         }
+
+         latenessCount++;
+
+         // the deadline is the window of the cpu time
+         windowMS = localPtr->relDeadlineMS;
+
+         // add the density, rounded up
+         densityPercent = ( localPtr->cpuDemandMS * 100 + windowMS - 1 )
+                                                                  / windowMS;
+         report->loadPercent = report->loadPercent + densityPercent;
+
+         if( densityPercent > maxDensity )
+         {
+            maxDensity = densityPercent;
+         }
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   // sort the lateness and take the distribution from it
+      // function: sortLateness
+   sortLateness( latenessArray, latenessCount );
+
+   report->latenessMin = latenessArray[ 0 ];
+   report->latenessMedian = latenessArray[ ( latenessCount - 1 ) / 2 ];
+   report->latenessHigh = latenessArray[ ( latenessCount * 9 + 9 ) / 10 - 1 ];
+   report->latenessMax = latenessArray[ latenessCount - 1 ];
+
+   // test the load against the cores, less the largest density on all
+   //    but one core
+   if( report->loadPercent > coreCount * 100 - ( coreCount - 1 ) * maxDensity )
+   {
+      report->schedulableFlag = False;
+   }
+
+   // function: free
+   free( latenessArray );
+
+   // log the results
+      // function: displayAndLog
+   displayAndLog( simContext, NULL, DEADLINE_REPORT, NONE );
+   displayAndLog( simContext, NULL, LATENESS_REPORT, NONE );
+   displayAndLog( simContext, NULL, LOAD_REPORT, NONE );
+}
+
+/*
+Funtion name: reportProcessTimes
+Algorithm: logs the response time ( arrival to first run ) and turnaround
+           time ( arrival to exit ) of each process, then their means
+Precondition: every process is in EXIT
+Postcondiditon: the run's mean times are set and logged
+Exceptions: nothing is logged when every process arrives at the start
+Note: a process that exits without running responds at its exit
+*/
+void reportProcessTimes( SimContext *simContext )
+{
+   // initialize variables
+   PCB *localPtr = simContext->pcbListHead;
+   Boolean lateArrivalFound = False;
+   int responseSum = 0, turnaroundSum = 0;
+
+   // check for a process arriving after the start
+   while( localPtr != NULL )
+   {
+      if( localPtr->arrivalMSec > 0 )
+      {
+         lateArrivalFound = True;
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   // check for an empty run or one that starts all at once
+   if( lateArrivalFound == False )
+   {
+      return;
+   }
+
+   // loop across the processes
+   localPtr = simContext->pcbListHead;
+
+   while( localPtr != NULL )
+   {
+      // check for a process that never ran
+      if( localPtr->firstRunMSec < 0 )
+      {
+         localPtr->firstRunMSec = localPtr->exitMSec;
+      }
+
+      // add up its times
+      responseSum = responseSum + localPtr->firstRunMSec
+                                                   - localPtr->arrivalMSec;
+      turnaroundSum = turnaroundSum + localPtr->exitMSec
+                                                   - localPtr->arrivalMSec;
+
+      // log event
+         // function: displayAndLog
+      displayAndLog( simContext, localPtr, PROCESS_TIMES, NONE );
+
+      localPtr = localPtr->nextNode;
+   }
+
+   // set and log the means
+   simContext->meanResponseMS = responseSum / simContext->processCount;
+   simContext->meanTurnaroundMS = turnaroundSum / simContext->processCount;
+
+   // function: displayAndLog
+   displayAndLog( simContext, NULL, MEAN_TIMES, NONE );
+}
+
+/*
+Funtion name: sortLateness
+Algorithm: insertion sort of the lateness values, smallest first
+Precondition: array holds the count of values
+Postcondiditon: array is in ascending order
+Exceptions: none
+Note: one value per process, so the array is short
+*/
+void sortLateness( int *latenessArray, int latenessCount )
+{
+   // initialize variables
+   int sortedCount = 1;
+   int insertIndex, insertValue;
+
+   // loop across the unsorted values
+   while( sortedCount < latenessCount )
+   {
+      // shift the larger sorted values up past the next value
+      insertValue = latenessArray[ sortedCount ];
+      insertIndex = sortedCount;
+
+      while( insertIndex > 0 && latenessArray[ insertIndex - 1 ] > insertValue )
+      {
+         latenessArray[ insertIndex ] = latenessArray[ insertIndex - 1 ];
+         insertIndex--;
+      }
+
+      latenessArray[ insertIndex ] = insertValue;
+      sortedCount++;
+   }
+}
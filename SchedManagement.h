@@ -0,0 +1,126 @@
+// Pre-compiler directive
+#ifndef SCHED_MANAGEMENT_H
+#define SCHED_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include "StringUtils.h"
+#include "simulator.h"
+
+// events a scheduler is told about
+typedef enum { SCHED_EVENT_DISPATCH,
+               SCHED_EVENT_TICK,
+               SCHED_EVENT_BLOCK,
+               SCHED_EVENT_WAKE,
+               SCHED_EVENT_BOOST } schedEventCodes;
+
+// hook run on a scheduling event, null if the scheduler ignores it
+typedef void (*SchedHook)( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+
+// ready queue state of a policy kept in one heap
+typedef struct HeapQueue
+{
+   PcbHeap readyHeap;
+} HeapQueue;
+
+// ready queue state of round robin, the ring in dispatch order and a heap
+//    for the woken processes that waited longer than the ring tail
+typedef struct RoundRobinQueue
+{
+   PcbHeap readyHeap;
+   PcbRing readyRing;
+} RoundRobinQueue;
+
+// ready queue state of CFS, the virtual runtime tree and the least virtual
+//    runtime dispatched so far
+typedef struct FairQueue
+{
+   PcbTree readyTree;
+   int minVruntime;
+} FairQueue;
+
+// one scheduling policy; the registry index is its config code
+typedef struct SchedulerOps
+{
+   // name in the config file, and whether the policy takes the cpu from
+   //    a running process at the end of its slice
+   char *schedName;
+   Boolean preemptiveFlag;
+
+   // order of the ready queue, handed to its init
+   PcbBefore pcbBefore;
+
+   // ready queue operations
+   void (*initQueue)( ReadyQueue *readyQueue, PcbBefore pcbBefore );
+   void (*clearQueue)( ReadyQueue *readyQueue );
+   void (*enqueuePcb)( ReadyQueue *readyQueue, PCB *pcb );
+   void (*removePcb)( ReadyQueue *readyQueue, PCB *pcb );
+   PCB *(*peekNextPcb)( ReadyQueue *readyQueue );
+
+   // length of the next cpu slice of the process
+   int (*getSliceMS)( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount );
+
+   // selected to run, quantum used up, blocked for IO, back from IO and
+   //    priority boost
+   SchedHook onDispatch;
+   SchedHook onTick;
+   SchedHook onBlock;
+   SchedHook onWake;
+   SchedHook onBoost;
+
+   // process stolen by another core's queue, null if nothing moves with it
+   void (*onSteal)( ReadyQueue *fromQueue, ReadyQueue *toQueue, PCB *pcb );
+} SchedulerOps;
+
+// function prototypes
+const SchedulerOps *getScheduler( int schedCode );
+int findSchedulerCode( char *schedName );
+char *getSchedulerName( int schedCode );
+void runSchedEvent( SimContext *simContext, ReadyQueue *readyQueue,
+                                    PCB *pcb, schedEventCodes eventCode );
+Boolean msLeftPcbBefore( PCB *onePCB, PCB *otherPCB );
+Boolean dispatchPcbBefore( PCB *onePCB, PCB *otherPCB );
+Boolean levelPcbBefore( PCB *onePCB, PCB *otherPCB );
+Boolean duePcbBefore( PCB *onePCB, PCB *otherPCB );
+Boolean fairPcbBefore( PCB *onePCB, PCB *otherPCB );
+void initHeapQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore );
+void clearHeapQueue( ReadyQueue *readyQueue );
+void enqueueHeapPcb( ReadyQueue *readyQueue, PCB *pcb );
+void removeHeapPcb( ReadyQueue *readyQueue, PCB *pcb );
+PCB *peekHeapPcb( ReadyQueue *readyQueue );
+void initRoundRobinQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore );
+void clearRoundRobinQueue( ReadyQueue *readyQueue );
+void enqueueRoundRobinPcb( ReadyQueue *readyQueue, PCB *pcb );
+void removeRoundRobinPcb( ReadyQueue *readyQueue, PCB *pcb );
+PCB *peekRoundRobinPcb( ReadyQueue *readyQueue );
+void initFairQueue( ReadyQueue *readyQueue, PcbBefore pcbBefore );
+void clearFairQueue( ReadyQueue *readyQueue );
+void enqueueFairPcb( ReadyQueue *readyQueue, PCB *pcb );
+void removeFairPcb( ReadyQueue *readyQueue, PCB *pcb );
+PCB *peekFairPcb( ReadyQueue *readyQueue );
+int getQuantumSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount );
+int getLevelSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount );
+int getFairSliceMS( ConfigDataType *configPtr, PCB *pcb,
+                                                      int runnableCount );
+void lowerPcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+void raisePcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+void resetPcbLevel( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+void advanceMinVruntime( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+void placeWokenPcb( ConfigDataType *configPtr, ReadyQueue *readyQueue,
+                                                                  PCB *pcb );
+void moveStolenVruntime( ReadyQueue *fromQueue, ReadyQueue *toQueue,
+                                                                  PCB *pcb );
+void reportDeadlines( SimContext *simContext );
+void reportProcessTimes( SimContext *simContext );
+void sortLateness( int *latenessArray, int latenessCount );
+
+#endif   // SCHED_MANAGEMENT_H
@@ -0,0 +1,1216 @@
+// needed for pthread_barrier_t in the parallel run state
+#define _POSIX_C_SOURCE 200112L
+
+#include "SmpManagement.h"
+#include "CpuManagement.h"
+#include "QueueManagement.h"
+#include "IoManagement.h"
+#include "PdesManagement.h"
+#include "SchedManagement.h"
+#include "DeviceManagement.h"
+#include "MemoryManagement.h"
+#include "PageManagement.h"
+
+/*
+Funtion name: runSmpSim
+Algorithm: runs the processes on the configured number of cores; each core
+           dispatches from its own run queue, the run steps from one event
+           time to the next ( slice end, IO completion or balance tick ),
+           and at each time the cores handle their events in core order
+Precondition: PCBs are READY in the global ready queue ( or queued finished )
+Postcondiditon: all processes are in EXIT state, core summaries are logged
+Exceptions: none
+Note: idle cores only steal work at balance ticks, one quantum apart;
+      a virtual time run with host threads runs the cores in parallel,
+      unless the device channels are limited
+*/
+void runSmpSim( SimContext *simContext )
+{
+   // initialize variables
+   int balanceMS;
+   int nextMSec = 0;
+   int coreIndex;
+   int workerCount = simContext->configPtr->hostThreadCount;
+
+   // hand the PCBs to the cores
+      // function: initSmpCores
+   initSmpCores( simContext );
+
+   // find the balance tick length
+      // function: getBalanceMS
+   balanceMS = getBalanceMS( simContext );
+
+   // the MLFQ priority boost falls on a balance tick
+      // function: getSmpBoostMS
+   simContext->nextBoostMSec = getSmpBoostMS( simContext, balanceMS );
+
+   // no more workers than cores
+   if( workerCount > simContext->coreCount )
+   {
+      workerCount = simContext->coreCount;
+   }
+
+   // check for a parallel run, real time runs on one thread, and so do
+   //    limited devices, whose next request may be on another worker's core
+   if( workerCount > 1
+        && simContext->timer.timerMode == VIRTUAL_TIME_MODE
+        && hasLimitedDevice( simContext->configPtr ) == False )
+   {
+      // function: runPdesSim
+      runPdesSim( simContext, workerCount, balanceMS );
+
+      // skip the single thread loop
+      nextMSec = -1;
+   }
+
+   // loop until no core has an event left
+   while( nextMSec >= 0 )
+   {
+      // run the timer up to the event time
+         // function: runTimer
+      runTimer( &simContext->timer, nextMSec - simContext->simMSec );
+      simContext->simMSec = nextMSec;
+
+      // check for the MLFQ priority boost
+      if( simContext->simMSec == simContext->nextBoostMSec )
+      {
+         // function: boostSmpLevels
+         boostSmpLevels( simContext, balanceMS );
+      }
+
+      // check for a balance tick
+      if( simContext->simMSec % balanceMS == 0 )
+      {
+         // function: balanceSmpCores
+         balanceSmpCores( simContext );
+      }
+
+      // handle the events of each core
+      coreIndex = 0;
+
+      while( coreIndex < simContext->coreCount )
+      {
+         // function: runCoreEvents
+         runCoreEvents( simContext, &simContext->coreArray[ coreIndex ] );
+
+         coreIndex++;
+      }
+
+      // find the next event time
+         // function: findNextSmpTime
+      nextMSec = findNextSmpTime( simContext, balanceMS );
+   }
+   // end loop
+
+   // log event
+   simContext->logCoreId = -1;
+   displayAndLog( simContext, NULL, ALL_EXIT, NONE );
+
+   // log the summary of each core
+   coreIndex = 0;
+
+   while( coreIndex < simContext->coreCount )
+   {
+      simContext->logCoreId = coreIndex;
+      displayAndLog( simContext, NULL, CORE_REPORT, NONE );
+
+      coreIndex++;
+   }
+
+   simContext->logCoreId = -1;
+}
+
+/*
+Funtion name: initSmpCores
+Algorithm: sets up the cores, exits the empty programs and moves every
+           READY PCB from the global ready queue to the run queue of core
+           ( pid mod core count ), and every PCB yet to arrive to the event
+           heap of that core
+Precondition: context core count is above one
+Postcondiditon: global ready queue is empty, the cores hold the PCBs
+Exceptions: none
+Note: none
+*/
+void initSmpCores( SimContext *simContext )
+{
+   // initialize variables
+   int coreIndex = 0;
+   SimCore *core;
+   PCB *localPtr;
+
+   // allocate the cores
+      // function: malloc
+   simContext->coreArray =
+           (SimCore *)malloc( sizeof( SimCore ) * simContext->coreCount );
+
+   // set up each core
+   while( coreIndex < simContext->coreCount )
+   {
+      core = &simContext->coreArray[ coreIndex ];
+
+      core->coreId = coreIndex;
+
+      // the run queue is ordered by the run's scheduler
+         // function: initQueue, initHeap
+      simContext->schedOps->initQueue( &core->readyQueue,
+                                         simContext->schedOps->pcbBefore );
+      core->readyCount = 0;
+      core->enqueueCounter = 0;
+      initHeap( &core->eventHeap, deadlinePcbBefore );
+
+      core->runningPCB = NULL;
+      core->sliceStart = 0;
+      core->sliceEnd = 0;
+      core->previousPid = -1;
+
+      core->busyMS = 0;
+      core->dispatchCount = 0;
+      core->stealCount = 0;
+
+      core->pendingOverheadMS = 0;
+      core->overheadFlag = False;
+      core->overheadMS = 0;
+      core->switchCount = 0;
+      core->interruptCount = 0;
+
+         // function: initTlb
+      initTlb( &core->tlb, simContext->configPtr );
+
+      coreIndex++;
+   }
+
+   // exit the programs that are already at app end
+      // function: checkListForFinishAndReady
+   checkListForFinishAndReady( simContext );
+
+   // move each READY PCB to its home core
+   localPtr = simContext->pcbListHead;
+
+   while( localPtr != NULL )
+   {
+      // check for a READY PCB
+      if( localPtr->processState == PCB_READY_STATE )
+      {
+         // take it out of the global ready queue
+            // function: setPcbState
+         setPcbState( simContext, localPtr, PCB_NEW_STATE );
+
+         // function: setCorePcbState
+         setCorePcbState( simContext,
+            &simContext->coreArray[ localPtr->pid % simContext->coreCount ],
+                                                localPtr, PCB_READY_STATE );
+      }
+      // otherwise, check for a process that arrives later
+      else if( localPtr->processState == PCB_NEW_STATE )
+      {
+         // move it to the event heap of its home core
+            // function: removeEventNode, addHeapNode
+         removeEventNode( simContext, localPtr );
+         localPtr->coreId = localPtr->pid % simContext->coreCount;
+         addHeapNode( &simContext->coreArray[ localPtr->coreId ].eventHeap,
+                                                                  localPtr );
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+}
+
+/*
+Funtion name: clearSmpCores
+Algorithm: releases the core queues and the core array
+Precondition: context was set up by initSimContext
+Postcondiditon: core array is freed and set to null
+Exceptions: none
+Note: a single core run has no core array
+*/
+void clearSmpCores( SimContext *simContext )
+{
+   // initialize variables
+   int coreIndex = 0;
+
+   // check for no core array
+   if( simContext->coreArray == NULL )
+   {
+      return;
+   }
+
+   // release the queues of each core
+      // function: clearQueue, clearHeap, clearTlb
+   while( coreIndex < simContext->coreCount )
+   {
+      simContext->schedOps->clearQueue(
+                             &simContext->coreArray[ coreIndex ].readyQueue );
+      clearHeap( &simContext->coreArray[ coreIndex ].eventHeap );
+      clearTlb( &simContext->coreArray[ coreIndex ].tlb );
+
+      coreIndex++;
+   }
+
+   // function: free
+   free( simContext->coreArray );
+   simContext->coreArray = NULL;
+}
+
+/*
+Funtion name: setCorePcbState
+Algorithm: moves a PCB from the core queue of its current state to the
+           core queue of the new state and keeps the counters current
+Precondition: PCB is in the queue of the given core matching its state
+Postcondiditon: PCB state is set, PCB is in the matching queue of the core
+Exceptions: none
+Note: NEW is used to hold a PCB that is in no core queue while it moves,
+      and a PCB waiting to arrive on the core event heap
+*/
+void setCorePcbState( SimContext *simContext, SimCore *core, PCB *pcb,
+                                                   pcbStateCodes newState )
+{
+   // take the PCB out of its current queue
+   switch( pcb->processState )
+   {
+      case PCB_READY_STATE:
+
+         // function: removePcb
+         simContext->schedOps->removePcb( &core->readyQueue, pcb );
+         core->readyCount--;
+
+         break;
+
+      case PCB_BLOCKED_STATE:
+
+         // the op is done, its device channel serves the next request
+            // function: removeHeapNode, releaseDevice
+         removeHeapNode( &core->eventHeap, pcb );
+         releaseDevice( simContext, pcb );
+         simContext->blockedCount--;
+
+         break;
+
+      case PCB_RUNNING_STATE:
+
+         core->runningPCB = NULL;
+
+         break;
+
+      case PCB_EXIT_STATE:
+
+         simContext->exitCount--;
+
+         break;
+
+      case PCB_NEW_STATE:
+
+         // check for a process waiting to arrive on the core
+         if( pcb->heapIndex >= 0 )
+         {
+            // function: removeHeapNode
+            removeHeapNode( &core->eventHeap, pcb );
+         }
+
+         break;
+   }
+
+   // put the PCB in the new queue
+   switch( newState )
+   {
+      case PCB_READY_STATE:
+
+         // stamp the enqueue, round robin runs the oldest stamp first
+         core->enqueueCounter++;
+         pcb->dispatchStamp = core->enqueueCounter;
+
+         // function: enqueuePcb
+         simContext->schedOps->enqueuePcb( &core->readyQueue, pcb );
+         core->readyCount++;
+
+         break;
+
+      case PCB_BLOCKED_STATE:
+
+         // the device starts the IO op now on this core's event heap, or
+         //    queues it
+            // function: requestDevice
+         pcb->coreId = core->coreId;
+         requestDevice( simContext, pcb );
+         simContext->blockedCount++;
+
+         break;
+
+      case PCB_RUNNING_STATE:
+
+         core->runningPCB = pcb;
+
+         // keep the time of the first run
+         if( pcb->firstRunMSec < 0 )
+         {
+            pcb->firstRunMSec = simContext->simMSec;
+         }
+
+         break;
+
+      case PCB_EXIT_STATE:
+
+         simContext->exitCount++;
+         pcb->exitReached = True;
+         pcb->exitMSec = simContext->simMSec;
+
+         break;
+
+      case PCB_NEW_STATE:
+         break;
+   }
+
+   // set the new state and core
+   pcb->processState = newState;
+   pcb->coreId = core->coreId;
+}
+
+/*
+Funtion name: getBalanceMS
+Algorithm: returns the ms between balance ticks, one quantum
+Precondition: none
+Postcondiditon: returns a length of at least one ms
+Exceptions: none
+Note: a zero quantum falls back to one cycle
+*/
+int getBalanceMS( SimContext *simContext )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int balanceMS = configPtr->quantumCycles * configPtr->procCycleRate;
+
+   // check for no quantum
+   if( balanceMS <= 0 )
+   {
+      balanceMS = configPtr->procCycleRate;
+   }
+
+   // check for no cycle length either
+   if( balanceMS <= 0 )
+   {
+      balanceMS = 1;
+   }
+
+   return balanceMS;
+}
+
+/*
+Funtion name: findNextSmpTime
+Algorithm: returns the earliest slice end or IO completion over all cores;
+           the next balance tick counts too when an idle core with an
+           empty run queue could steal from another core, and the next
+           MLFQ priority boost counts while any event is left
+Precondition: current time is the context sim ms
+Postcondiditon: returns the next event time, -1 if no event is left
+Exceptions: none
+Note: none
+*/
+int findNextSmpTime( SimContext *simContext, int balanceMS )
+{
+   // initialize variables
+   int nextMSec = -1;
+   int coreIndex = 0;
+   int tickMSec;
+   Boolean idleCoreFound = False;
+   Boolean queuedCoreFound = False;
+   SimCore *core;
+   PCB *nextEvent;
+
+   // loop through the cores
+   while( coreIndex < simContext->coreCount )
+   {
+      core = &simContext->coreArray[ coreIndex ];
+
+      // check for a running slice
+      if( core->runningPCB != NULL )
+      {
+         // check for an earlier event
+         if( nextMSec < 0 || core->sliceEnd < nextMSec )
+         {
+            nextMSec = core->sliceEnd;
+         }
+
+         // check for work that could be stolen
+         if( core->readyCount > 0 )
+         {
+            queuedCoreFound = True;
+         }
+      }
+      // otherwise, check for an idle core with nothing queued
+      else if( core->readyCount == 0 )
+      {
+         idleCoreFound = True;
+      }
+
+      // check for a blocked process
+         // function: peekHeapNode
+      nextEvent = peekHeapNode( &core->eventHeap );
+
+      if( nextEvent != NULL
+           && ( nextMSec < 0 || nextEvent->ioDeadline < nextMSec ) )
+      {
+         nextMSec = nextEvent->ioDeadline;
+      }
+
+      coreIndex++;
+   }
+
+   // check for a pending balance
+   if( idleCoreFound == True && queuedCoreFound == True )
+   {
+      // find the next tick
+      tickMSec = ( simContext->simMSec / balanceMS + 1 ) * balanceMS;
+
+      if( nextMSec < 0 || tickMSec < nextMSec )
+      {
+         nextMSec = tickMSec;
+      }
+   }
+
+   // check for an earlier priority boost
+   if( nextMSec >= 0 && simContext->nextBoostMSec >= 0
+                             && simContext->nextBoostMSec < nextMSec )
+   {
+      nextMSec = simContext->nextBoostMSec;
+   }
+
+   return nextMSec;
+}
+
+/*
+Funtion name: getSmpBoostMS
+Algorithm: returns the MLFQ boost interval rounded up to whole balance
+           ticks
+Precondition: none
+Postcondiditon: returns -1 when no boost is set
+Exceptions: none
+Note: boosting on a tick lets a parallel run boost between epochs
+*/
+int getSmpBoostMS( SimContext *simContext, int balanceMS )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   int tickCount;
+
+   // check for a scheduler without a boost, or no boost set
+   if( simContext->schedOps->onBoost == NULL
+                                          || configPtr->mlfqBoostMS <= 0 )
+   {
+      return -1;
+   }
+
+   tickCount = ( configPtr->mlfqBoostMS + balanceMS - 1 ) / balanceMS;
+
+   return tickCount * balanceMS;
+}
+
+/*
+Funtion name: boostSmpLevels
+Algorithm: moves every process that has not exited back to the top MLFQ
+           level, queueing the READY ones again on their cores, and sets
+           the next boost
+Precondition: current time is the boost time
+Postcondiditon: all processes are on level zero
+Exceptions: none
+Note: the READY processes keep their enqueue stamps
+*/
+void boostSmpLevels( SimContext *simContext, int balanceMS )
+{
+   // initialize variables
+   PCB *localPtr = simContext->pcbListHead;
+   SimCore *core;
+
+   // log event
+   simContext->logCoreId = -1;
+   displayAndLog( simContext, NULL, MLFQ_BOOST, NONE );
+
+   // loop across every process
+   while( localPtr != NULL )
+   {
+      // check for a process that has not exited
+      if( localPtr->exitReached == False )
+      {
+         core = &simContext->coreArray[ localPtr->coreId ];
+
+         // function: runSchedEvent
+         runSchedEvent( simContext, &core->readyQueue, localPtr,
+                                                        SCHED_EVENT_BOOST );
+      }
+
+      localPtr = localPtr->nextNode;
+   }
+
+   // function: getSmpBoostMS
+   simContext->nextBoostMSec = simContext->nextBoostMSec
+                                 + getSmpBoostMS( simContext, balanceMS );
+}
+
+/*
+Funtion name: balanceSmpCores
+Algorithm: in core order, each idle core with an empty run queue steals the
+           next process of the core with the most queued work beyond what
+           it can run now; ties go to the lower core
+Precondition: called at a balance tick, before the cores run their events
+Postcondiditon: stolen PCBs are READY on the stealing cores
+Exceptions: none
+Note: a core steals at most one process per tick
+*/
+void balanceSmpCores( SimContext *simContext )
+{
+   // initialize variables
+   int thiefIndex = 0;
+   int victimIndex;
+   int surplus;
+   int bestSurplus;
+   SimCore *thief;
+   SimCore *victim;
+   SimCore *bestVictim;
+   PCB *stolenPCB;
+
+   // loop through the cores
+   while( thiefIndex < simContext->coreCount )
+   {
+      thief = &simContext->coreArray[ thiefIndex ];
+
+      // check for an idle core with nothing queued
+      if( thief->runningPCB == NULL && thief->readyCount == 0 )
+      {
+         // find the core with the most work to spare
+         bestVictim = NULL;
+         bestSurplus = 0;
+         victimIndex = 0;
+
+         while( victimIndex < simContext->coreCount )
+         {
+            victim = &simContext->coreArray[ victimIndex ];
+            surplus = victim->readyCount;
+
+            // an idle core keeps the process it will dispatch next
+            if( victim->runningPCB == NULL )
+            {
+               surplus--;
+            }
+
+            if( surplus > bestSurplus )
+            {
+               bestVictim = victim;
+               bestSurplus = surplus;
+            }
+
+            victimIndex++;
+         }
+
+         // check for work to steal
+         if( bestVictim != NULL )
+         {
+            // take the next process of the victim
+               // function: peekNextPcb
+            stolenPCB = simContext->schedOps->peekNextPcb(
+                                                   &bestVictim->readyQueue );
+
+            // log event
+            simContext->logCoreId = thief->coreId;
+            displayAndLog( simContext, stolenPCB, PCB_STEAL, NONE );
+
+            // move it to the idle core
+               // function: setCorePcbState
+            setCorePcbState( simContext, bestVictim, stolenPCB,
+                                                         PCB_NEW_STATE );
+
+            // let the scheduler move its queue state along
+               // function: onSteal
+            if( simContext->schedOps->onSteal != NULL )
+            {
+               simContext->schedOps->onSteal( &bestVictim->readyQueue,
+                                          &thief->readyQueue, stolenPCB );
+            }
+
+            setCorePcbState( simContext, thief, stolenPCB, PCB_READY_STATE );
+
+            thief->stealCount++;
+         }
+      }
+
+      thiefIndex++;
+   }
+}
+
+/*
+Funtion name: runCoreEvents
+Algorithm: handles everything on a core at the current time; due IO
+           completions first ( preempting the running slice ), then the
+           end of the running slice, then dispatch from the run queue when
+           the core is idle; repeats until nothing is left at this time
+Precondition: current time is the context sim ms
+Postcondiditon: core is running a slice that ends later, or is idle with
+                an empty run queue
+Exceptions: none
+Note: zero length ops end at the time they start
+*/
+void runCoreEvents( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   Boolean eventFound = True;
+   PCB *localPtr;
+
+   // log against this core
+   simContext->logCoreId = core->coreId;
+
+   // loop until no event is left at this time
+   while( eventFound == True )
+   {
+      eventFound = False;
+
+      // find the earliest IO completion
+         // function: peekHeapNode
+      localPtr = peekHeapNode( &core->eventHeap );
+
+      // check for a due arrival
+      if( localPtr != NULL && localPtr->ioDeadline <= simContext->simMSec
+                              && localPtr->processState == PCB_NEW_STATE )
+      {
+         eventFound = True;
+
+         // the arrival takes the core from a slice still in progress,
+         //    unless the scheduler runs each process to its end or the
+         //    core is paying the overhead of a dispatch
+         if( core->runningPCB != NULL
+                           && core->sliceEnd > simContext->simMSec
+                           && simContext->schedOps->preemptiveFlag == True
+                           && core->overheadFlag == False )
+         {
+            // function: preemptCoreSlice
+            preemptCoreSlice( simContext, core );
+         }
+
+         // log event
+         displayAndLog( simContext, localPtr, PCB_NEW, PCB_READY );
+
+         // set up PCB for running
+            // function: updatePcbOpCode
+         localPtr->opMSLeft = 0;
+         updatePcbOpCode( localPtr, simContext->configPtr );
+
+         // let the scheduler place it as it would a woken process
+            // function: runSchedEvent
+         runSchedEvent( simContext, &core->readyQueue, localPtr,
+                                                         SCHED_EVENT_WAKE );
+
+         // function: setCorePcbState
+         setCorePcbState( simContext, core, localPtr, PCB_READY_STATE );
+
+         // check for an empty program
+         if( compareString( localPtr->currentOpCode->command, "app" )
+                                                                  == STR_EQ )
+         {
+            // function: exitCoreProcess
+            exitCoreProcess( simContext, core, localPtr );
+         }
+      }
+      // otherwise, check for a due IO completion
+      else if( localPtr != NULL
+                              && localPtr->ioDeadline <= simContext->simMSec )
+      {
+         eventFound = True;
+
+         // the interrupt takes the core from a slice still in progress,
+         //    but not from the overhead of a dispatch
+         if( core->runningPCB != NULL
+                                 && core->sliceEnd > simContext->simMSec
+                                 && core->overheadFlag == False )
+         {
+            // function: preemptCoreSlice
+            preemptCoreSlice( simContext, core );
+         }
+
+         // the process wakes once its IO worker has finished the op
+            // function: awaitIoCompletion
+         awaitIoCompletion( &simContext->ioPool, localPtr );
+
+         // charge the process for the time it was blocked
+         localPtr->msLeft = localPtr->msLeft - localPtr->opMSLeft;
+         localPtr->opMSLeft = 0;
+
+         // log event
+         displayAndLog( simContext, localPtr, FINISH_INT, NONE );
+
+         // log event
+         displayAndLog( simContext, localPtr, PCB_BLOCKED, NONE );
+
+         // function: chargeInterrupt
+         chargeInterrupt( simContext, core );
+
+         // update the specific PCB
+            // function: updatePcbOpCode
+         updatePcbOpCode( localPtr, simContext->configPtr );
+
+         // tell the scheduler it is back from IO
+            // function: runSchedEvent
+         runSchedEvent( simContext, &core->readyQueue, localPtr,
+                                                         SCHED_EVENT_WAKE );
+
+         // set it back to ready
+            // function: setCorePcbState
+         setCorePcbState( simContext, core, localPtr, PCB_READY_STATE );
+
+         // check if it has reached app end
+         if( compareString( localPtr->currentOpCode->command, "app" )
+                                                                  == STR_EQ )
+         {
+            // function: exitCoreProcess
+            exitCoreProcess( simContext, core, localPtr );
+         }
+      }
+      // otherwise, check for the end of the running slice
+      else if( core->runningPCB != NULL
+                                 && core->sliceEnd <= simContext->simMSec )
+      {
+         eventFound = True;
+
+         // check for the end of the overhead of a dispatch
+         if( core->overheadFlag == True )
+         {
+            core->overheadFlag = False;
+
+            // run its ops up to its first slice
+               // function: runCoreProcess
+            runCoreProcess( simContext, core, core->runningPCB );
+         }
+         // otherwise, the process slice has ended
+         else
+         {
+            // function: finishCoreSlice
+            finishCoreSlice( simContext, core );
+         }
+      }
+      // otherwise, check for an idle core with work queued
+      else if( core->runningPCB == NULL && core->readyCount > 0 )
+      {
+         eventFound = True;
+
+         // the run queue is ordered for the scheduler
+            // function: peekNextPcb
+         localPtr = simContext->schedOps->peekNextPcb( &core->readyQueue );
+
+         if( localPtr->pid != core->previousPid )
+         {
+            // log event
+            displayAndLog( simContext, localPtr, PCB_SELECT, NONE );
+
+            // log event
+            displayAndLog( simContext, localPtr, PCB_READY, PCB_RUNNING );
+
+            // a switch to another process costs the switch and the dispatch
+               // function: chargeSwitch
+            chargeSwitch( simContext, core );
+         }
+
+         // set the process to running
+            // function: setCorePcbState
+         setCorePcbState( simContext, core, localPtr, PCB_RUNNING_STATE );
+
+         // tell the scheduler
+            // function: runSchedEvent
+         runSchedEvent( simContext, &core->readyQueue, localPtr,
+                                                     SCHED_EVENT_DISPATCH );
+
+         core->previousPid = localPtr->pid;
+         core->dispatchCount++;
+
+         // check for overhead owed, the core pays it as a slice of its own
+         //    before the process runs
+         if( core->pendingOverheadMS > 0 )
+         {
+            core->overheadMS = core->overheadMS + core->pendingOverheadMS;
+            core->sliceStart = simContext->simMSec;
+            core->sliceEnd = simContext->simMSec + core->pendingOverheadMS;
+            core->pendingOverheadMS = 0;
+            core->overheadFlag = True;
+         }
+         // otherwise, run its ops up to its first slice
+         else
+         {
+            // function: runCoreProcess
+            runCoreProcess( simContext, core, localPtr );
+         }
+      }
+   }
+   // end loop
+}
+
+/*
+Funtion name: preemptCoreSlice
+Algorithm: charges the running process for the part of its slice that has
+           run and puts it back in the run queue
+Precondition: core is running a slice that ends after the current time
+Postcondiditon: core is idle, the process is READY on the core
+Exceptions: none
+Note: as with one core, the IO interrupt sends it back quietly
+*/
+void preemptCoreSlice( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   PCB *runningPCB = core->runningPCB;
+   int elapsedMS = simContext->simMSec - core->sliceStart;
+
+   // a device op or swap in slice ends once its IO worker is done
+      // function: awaitIoCompletion
+   awaitIoCompletion( &simContext->ioPool, runningPCB );
+
+   // charge the time run
+   runningPCB->msLeft = runningPCB->msLeft - elapsedMS;
+   runningPCB->opMSLeft = runningPCB->opMSLeft - elapsedMS;
+   runningPCB->vruntime = runningPCB->vruntime + elapsedMS;
+   core->busyMS = core->busyMS + elapsedMS;
+
+   // set it back to ready
+      // function: setCorePcbState
+   setCorePcbState( simContext, core, runningPCB, PCB_READY_STATE );
+}
+
+/*
+Funtion name: finishCoreSlice
+Algorithm: charges the running process for its slice; a finished op moves
+           the process on to its next ops, a quantum time out puts it back
+           in the run queue
+Precondition: running slice ends at the current time
+Postcondiditon: process is running a new slice, READY, BLOCKED or EXIT
+Exceptions: none
+Note: device ops and the swap in of a page fault only run as slices for
+      non-preemptive codes
+*/
+void finishCoreSlice( SimContext *simContext, SimCore *core )
+{
+   // initialize variables
+   PCB *runningPCB = core->runningPCB;
+   int elapsedMS = simContext->simMSec - core->sliceStart;
+
+   // charge the time run
+   runningPCB->msLeft = runningPCB->msLeft - elapsedMS;
+   runningPCB->opMSLeft = runningPCB->opMSLeft - elapsedMS;
+
+   // check for the swap in of a page fault, the access is done
+   if( runningPCB->swapPageCount > 0 )
+   {
+      // log event
+      displayAndLog( simContext, runningPCB, MEM_SUCCESS, NONE );
+
+      // function: updatePcbOpCode, runCoreProcess
+      updatePcbOpCode( runningPCB, simContext->configPtr );
+      runCoreProcess( simContext, core, runningPCB );
+
+      return;
+   }
+
+   // check for a device op
+   if( compareString( runningPCB->currentOpCode->command, "dev" ) == STR_EQ )
+   {
+      // log event
+      displayAndLog( simContext, runningPCB, DEV, FINISH );
+
+      // function: updatePcbOpCode, runCoreProcess
+      updatePcbOpCode( runningPCB, simContext->configPtr );
+      runCoreProcess( simContext, core, runningPCB );
+
+      return;
+   }
+
+   // only cpu time counts as busy
+   core->busyMS = core->busyMS + elapsedMS;
+   runningPCB->vruntime = runningPCB->vruntime + elapsedMS;
+
+   // check for the op finished
+   if( runningPCB->opMSLeft <= 0 )
+   {
+      // log event
+      displayAndLog( simContext, runningPCB, CPU, FINISH );
+
+      // function: updatePcbOpCode, runCoreProcess
+      updatePcbOpCode( runningPCB, simContext->configPtr );
+      runCoreProcess( simContext, core, runningPCB );
+   }
+   // otherwise, assume the quantum ran out
+   else
+   {
+      // log event
+      displayAndLog( simContext, runningPCB, QUANT_INT, NONE );
+
+      // function: chargeInterrupt
+      chargeInterrupt( simContext, core );
+
+      // tell the scheduler the quantum was used up
+         // function: runSchedEvent
+      runSchedEvent( simContext, &core->readyQueue, runningPCB,
+                                                         SCHED_EVENT_TICK );
+
+      // set it back to ready
+         // function: setCorePcbState
+      setCorePcbState( simContext, core, runningPCB, PCB_READY_STATE );
+   }
+}
+
+/*
+Funtion name: runCoreProcess
+Algorithm: runs the ops of the running process from the current time; mem
+           ops complete at once unless they fault a page, a cpu op ( or a
+           device op or page fault for the non-preemptive codes ) starts
+           a slice, a device op or page fault for the preemptive codes
+           blocks the process, app end exits it
+Precondition: process is RUNNING on the core
+Postcondiditon: core is running a slice, or the process left the core
+Exceptions: none
+Note: the slice of a cpu op is capped by the quantum for preemptive codes
+*/
+void runCoreProcess( SimContext *simContext, SimCore *core, PCB *pcb )
+{
+   // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
+   Boolean preemptive = simContext->schedOps->preemptiveFlag;
+   int quantumMS = getQuantumMS( simContext, pcb );
+   int sliceMS;
+   Boolean segFault;
+   MemoryBlock memNode;
+   SimContext *memContext;
+   int translationMS;
+
+   // loop until the process leaves the core or starts a slice
+   while( True )
+   {
+      // check for app end
+      if( compareString( pcb->currentOpCode->command, "app" ) == STR_EQ )
+      {
+         // function: exitCoreProcess
+         exitCoreProcess( simContext, core, pcb );
+
+         return;
+      }
+
+      // check for a mem op
+      if( compareString( pcb->currentOpCode->command, "mem" ) == STR_EQ )
+      {
+         // create new mem node
+         memNode.lowerBound = pcb->currentOpCode->intArg2;
+         memNode.upperBound = ( pcb->currentOpCode->intArg3
+                                             + pcb->currentOpCode->intArg2 );
+         memNode.designatedPCB = pcb;
+
+         // log event
+         displayAndLog( simContext, pcb, MEM_START, NONE );
+
+         translationMS = 0;
+
+         // wait for the turn of the op on the shared memory blocks
+            // function: enterSharedEvent
+         memContext = enterSharedEvent( simContext, core );
+
+         // check if it specifies allocation
+         if( compareString( pcb->currentOpCode->strArg1, "allocate" )
+                                                                  == STR_EQ )
+         {
+            // function: allocateMem
+            segFault = allocateMem( memContext, &memNode );
+         }
+         // otherwise, it is an access request
+         else
+         {
+            // function: accessMem
+            segFault = accessMem( memContext, memNode.lowerBound,
+                                           memNode.upperBound, pcb->pid );
+
+            // check for a paged access, the core owes the translation
+               // function: translateAccess
+            if( segFault == False && configPtr->pageSize > 0 )
+            {
+               translationMS = translateAccess( memContext, &core->tlb, pcb,
+                                    memNode.lowerBound, memNode.upperBound,
+                                                      simContext->simMSec );
+            }
+         }
+
+         // check if seg fault occured
+         if( segFault == True )
+         {
+            // count the seg fault
+            simContext->segFaultCount++;
+
+            // log event
+            displayAndLog( simContext, pcb, MEM_FAIL, NONE );
+
+            // function: chargeInterrupt
+            chargeInterrupt( simContext, core );
+
+            // function: exitCoreProcess
+            exitCoreProcess( simContext, core, pcb );
+
+            return;
+         }
+
+         // check for a page fault, the translation is owed to the next
+         //    dispatch
+         if( pcb->swapPageCount > 0 )
+         {
+            core->pendingOverheadMS = core->pendingOverheadMS
+                                                            + translationMS;
+
+            // function: startPageFault, submitIoRequest
+            startPageFault( simContext, pcb );
+            submitIoRequest( &simContext->ioPool, &simContext->timer, pcb );
+
+            // check for a preemptive code, the process blocks for the
+            //    swap device
+            if( preemptive == True )
+            {
+               // log event
+               displayAndLog( simContext, pcb, BLOCKED_INT, NONE );
+
+               // log event
+               displayAndLog( simContext, pcb, PCB_RUNNING, PCB_BLOCKED );
+
+               // function: chargeInterrupt
+               chargeInterrupt( simContext, core );
+
+               // tell the scheduler the process gave up the core for IO
+                  // function: runSchedEvent
+               runSchedEvent( simContext, &core->readyQueue, pcb,
+                                                        SCHED_EVENT_BLOCK );
+
+               // function: setCorePcbState
+               setCorePcbState( simContext, core, pcb, PCB_BLOCKED_STATE );
+            }
+            // otherwise, the core waits out the swap in
+            else
+            {
+               core->sliceStart = simContext->simMSec;
+               core->sliceEnd = simContext->simMSec + pcb->opMSLeft;
+            }
+
+            return;
+         }
+
+         // log event
+         displayAndLog( simContext, pcb, MEM_SUCCESS, NONE );
+
+         // function: updatePcbOpCode
+         updatePcbOpCode( pcb, configPtr );
+
+         // check for translation owed, the core stalls for it as an
+         //    overhead slice before the next op
+         if( translationMS > 0 )
+         {
+            core->overheadMS = core->overheadMS + translationMS;
+            core->sliceStart = simContext->simMSec;
+            core->sliceEnd = simContext->simMSec + translationMS;
+            core->overheadFlag = True;
+
+            return;
+         }
+      }
+      // otherwise, check for a cpu op
+      else if( compareString( pcb->currentOpCode->command, "cpu" )
+                                                                  == STR_EQ )
+      {
+         // log event
+         displayAndLog( simContext, pcb, CPU, START );
+
+         // run to the end of the op, or to the quantum
+         sliceMS = pcb->opMSLeft;
+
+         if( preemptive == True && quantumMS > 0 && quantumMS < sliceMS )
+         {
+            sliceMS = quantumMS;
+         }
+
+         core->sliceStart = simContext->simMSec;
+         core->sliceEnd = simContext->simMSec + sliceMS;
+
+         return;
+      }
+      // otherwise, assume the op is dev
+      else
+      {
+         // log event
+         displayAndLog( simContext, pcb, DEV, START );
+
+         // hand the op to an IO worker ( real time only )
+            // function: submitIoRequest
+         submitIoRequest( &simContext->ioPool, &simContext->timer, pcb );
+
+         // check for a preemptive code
+         if( preemptive == True )
+         {
+            // log event
+            displayAndLog( simContext, pcb, BLOCKED_INT, NONE );
+
+            // log event
+            displayAndLog( simContext, pcb, PCB_RUNNING, PCB_BLOCKED );
+
+            // function: chargeInterrupt
+            chargeInterrupt( simContext, core );
+
+            // tell the scheduler the process gave up the core for IO
+               // function: runSchedEvent
+            runSchedEvent( simContext, &core->readyQueue, pcb,
+                                                        SCHED_EVENT_BLOCK );
+
+            // function: setCorePcbState
+            setCorePcbState( simContext, core, pcb, PCB_BLOCKED_STATE );
+         }
+         // otherwise, the core waits out the op
+         else
+         {
+            core->sliceStart = simContext->simMSec;
+            core->sliceEnd = simContext->simMSec + pcb->opMSLeft;
+         }
+
+         return;
+      }
+   }
+   // end loop
+}
+
+/*
+Funtion name: exitCoreProcess
+Algorithm: logs the exit of a process, gives its memory back and sets it
+           to EXIT
+Precondition: process is on the core
+Postcondiditon: process is in EXIT state, it holds no memory
+Exceptions: none
+Note: the memory checks of other cores see the blocks released, so it
+      waits for its turn as a shared event
+*/
+void exitCoreProcess( SimContext *simContext, SimCore *core, PCB *pcb )
+{
+   // initialize variables
+   SimContext *memContext;
+
+   // log event
+   displayAndLog( simContext, pcb, PCB_EXIT, NONE );
+
+   // function: enterSharedEvent
+   memContext = enterSharedEvent( simContext, core );
+
+   // give its memory back to the shared blocks
+      // function: releaseMemory
+   releaseMemory( memContext, pcb );
+
+   // function: setCorePcbState
+   setCorePcbState( simContext, core, pcb, PCB_EXIT_STATE );
+}
+
+/*
+Funtion name: getCoreBusyPercent
+Algorithm: returns the share of the run the core spent on cpu ops
+Precondition: none
+Postcondiditon: returns a whole percent
+Exceptions: none
+Note: a run of no time reports zero
+*/
+int getCoreBusyPercent( SimCore *core, int runMSec )
+{
+   // check for no run time
+   if( runMSec <= 0 )
+   {
+      return 0;
+   }
+
+   return (int) ( (long long) core->busyMS * 100 / runMSec );
+}
@@ -0,0 +1,29 @@
+// Pre-compiler directive
+#ifndef SMP_MANAGEMENT_H
+#define SMP_MANAGEMENT_H
+
+// header files
+#include <stdio.h> // file operations
+#include <stdlib.h> // dynamic memory operations
+#include "StringUtils.h"
+#include "simulator.h"
+
+// function prototypes
+void runSmpSim( SimContext *simContext );
+void initSmpCores( SimContext *simContext );
+void clearSmpCores( SimContext *simContext );
+void setCorePcbState( SimContext *simContext, SimCore *core, PCB *pcb,
+                                                   pcbStateCodes newState );
+int getBalanceMS( SimContext *simContext );
+int findNextSmpTime( SimContext *simContext, int balanceMS );
+int getSmpBoostMS( SimContext *simContext, int balanceMS );
+void boostSmpLevels( SimContext *simContext, int balanceMS );
+void balanceSmpCores( SimContext *simContext );
+void runCoreEvents( SimContext *simContext, SimCore *core );
+void preemptCoreSlice( SimContext *simContext, SimCore *core );
+void finishCoreSlice( SimContext *simContext, SimCore *core );
+void runCoreProcess( SimContext *simContext, SimCore *core, PCB *pcb );
+void exitCoreProcess( SimContext *simContext, SimCore *core, PCB *pcb );
+int getCoreBusyPercent( SimCore *core, int runMSec );
+
+#endif   // SMP_MANAGEMENT_H
@@ -2,6 +2,9 @@
 #include <stdio.h>
 #include "configops.h"
 #include "StringUtils.h"
+#include "SchedManagement.h"
+#include "metadataops.h"
+#include "DeviceManagement.h"
 
 // global constants
 
@@ -33,20 +36,18 @@ ConfigDataType *clearConfigData( ConfigDataType *configData )
 /*
 Funtion name: configCodeToString
 Algorithm: utility function to support display
-           of CPU scheduling or log to code strings
-Precondition: code variable holds constant value from ConfigDataCodes
-              for item (e.g., CPU_SCHED_SRTF_P, LOGTO_FILE_CODE, etc.)
+           of log to code strings
+Precondition: code variable holds constant value from ConfigLogDataCodes
+              for item (e.g., LOGTO_FILE_CODE, etc.)
 Postcondiditon: string parameter holds correct string
                 associated with the given constant
 Exceptions: none
-Note: none
+Note: scheduler names come from the scheduler registry
 */
 void configCodeToString( int code, char *outString )
 {
-   // define array with eight items, and short (10) lengths
-   char displayStrings[ 8 ][ 10 ] = { "SJF-N", "SRTF-P", "FCDS-P",
-                                      "RR-P", "FCFS-N", "Monitor",
-                                      "File", "Both" };
+   // define array with three items, and short (10) lengths
+   char displayStrings[ 3 ][ 10 ] = { "Monitor", "File", "Both" };
                                       
    // copy string to return to parameter
       // function: copyString
@@ -65,22 +66,105 @@ void displayConfigData( ConfigDataType *configData )
 {
    // initialize function variables
    char displayString[ STD_STR_LEN ];
+   int levelIndex;
+   int deviceIndex;
    
    // print lines of display
-      // function: printf, configCodeToString (translates coded items)
+      // function: printf, getSchedulerName, configCodeToString
+      //    (translates coded items)
    printf( "Config File Display\n" );
    printf( "-------------------\n" );
    printf( "Version                : %3.2f\n", configData->version );
    printf( "Program File Name      : %s\n", configData->metaDataFileName );
-   configCodeToString( configData->cpuSchedCode, displayString );
-   printf( "CPU schedule selection : %s\n", displayString );
+   printf( "CPU schedule selection : %s\n",
+                               getSchedulerName( configData->cpuSchedCode ) );
    printf( "Quantum time           : %d\n", configData->quantumCycles );
    printf( "Memory Available       : %d\n", configData->memAvailable );
    printf( "Process cycle rate     : %d\n", configData->procCycleRate );
    printf( "I/O cycle rate         : %d\n", configData->ioCycleRate );
    configCodeToString( configData->logToCode, displayString );
    printf( "Log to selection       : %s\n", displayString );
-   printf( "Log file name          : %s\n\n", configData->logToFileName );
+   printf( "Log file name          : %s\n", configData->logToFileName );
+   printf( "Time scale             : %4.2f\n", configData->timeScale );
+   
+   // check for the timing wheel
+   if( configData->ioTimerCode == IO_TIMER_WHEEL_CODE )
+   {
+      printf( "I/O timer              : Wheel\n" );
+   }
+   // otherwise, assume the event heap
+   else
+   {
+      printf( "I/O timer              : Heap\n" );
+   }
+   printf( "CPU cores              : %d\n", configData->cpuCoreCount );
+   printf( "Host threads           : %d\n", configData->hostThreadCount );
+   printf( "MLFQ quanta            :" );
+   
+   // loop through the levels
+   levelIndex = 0;
+   
+   while( levelIndex < configData->mlfqLevelCount )
+   {
+      printf( " %d", configData->mlfqQuantumArray[ levelIndex ] );
+      
+      levelIndex++;
+   }
+   
+   printf( "\nMLFQ boost (msec)      : %d\n", configData->mlfqBoostMS );
+   printf( "CFS latency (msec)     : %d\n", configData->cfsLatencyMS );
+   printf( "CFS granularity (msec) : %d\n",
+                                          configData->cfsGranularityMS );
+   printf( "Device channels        : %d\n", configData->deviceChannels );
+   
+   // check for the disk service order
+   if( configData->diskOrderCode == DISK_ORDER_SCAN_CODE )
+   {
+      printf( "Disk order             : SCAN\n" );
+   }
+   else if( configData->diskOrderCode == DISK_ORDER_CLOOK_CODE )
+   {
+      printf( "Disk order             : C-LOOK\n" );
+   }
+   // otherwise, assume first in first out
+   else
+   {
+      printf( "Disk order             : FIFO\n" );
+   }
+   printf( "Disk seek (msec/100)   : %d\n", configData->diskSeekRate );
+   
+   // loop through the device table
+   deviceIndex = 0;
+   
+   while( deviceIndex < DEVICE_COUNT )
+   {
+      printf( "Device %-16s: in %d, out %d msec, channels %d\n",
+              getDeviceName( deviceIndex ),
+              configData->deviceTable[ deviceIndex ].inCycleRate,
+              configData->deviceTable[ deviceIndex ].outCycleRate,
+              configData->deviceTable[ deviceIndex ].channelCount );
+      
+      deviceIndex++;
+   }
+   
+   printf( "Context switch (msec)  : %d\n", configData->contextSwitchMS );
+   printf( "Dispatch latency (msec): %d\n",
+                                          configData->dispatchLatencyMS );
+   printf( "Interrupt cost (msec)  : %d\n", configData->interruptCostMS );
+   printf( "Memory placement       : %s\n",
+                          getPlacementName( configData->memPlacementCode ) );
+   printf( "Page size (KB)         : %d\n", configData->pageSize );
+   printf( "Page table levels      : %d\n", configData->pageLevelCount );
+   printf( "TLB entries            : %d, %s\n", configData->tlbEntryCount,
+                              getTlbPolicyName( configData->tlbPolicyCode ) );
+   printf( "TLB miss (cycles)      : %d\n", configData->tlbMissCycles );
+   printf( "Page walk (cycles)     : %d\n", configData->pageWalkCycles );
+   printf( "Resident frames        : %d, %s\n",
+                 configData->residentFrameCount,
+                 getPageReplaceName( configData->pageReplaceCode ) );
+   printf( "Working set (msec)     : %d\n", configData->workingSetMS );
+   printf( "Thrashing rate (%%)     : %d\n", configData->thrashPercent );
+   printf( "\n" );
 }
 
 /*
@@ -118,8 +202,12 @@ Boolean getConfigData(char *fileName,
       FILE *fileAccessPtr;
       char dataBuffer[ MAX_STR_LEN ];
       int intData, dataLineCode, lineCtr = 0;
+      int levelIndex, deviceId;
+      DeviceConfig deviceConfig;
       double doubleData;
       Boolean dontStopAtNonPrintable = False;
+      Boolean stopAtNonPrintable = True;
+      Boolean endLineFound = False;
       
    // set endStateMsg to success
       // function: copyString
@@ -166,14 +254,57 @@ Boolean getConfigData(char *fileName,
    // create temporary pointer to configuration data structure
    tempData = (ConfigDataType *) malloc( sizeof( ConfigDataType ) );
    
-   // loop to the end of the config data items
-   while( lineCtr < NUM_DATA_LINES )
+   // set optional config items to their defaults
+   tempData->timeScale = 1.0;
+   tempData->ioTimerCode = IO_TIMER_HEAP_CODE;
+   tempData->cpuCoreCount = 1;
+   tempData->hostThreadCount = 1;
+   tempData->mlfqLevelCount = 0;
+   tempData->mlfqBoostMS = 0;
+   tempData->cfsLatencyMS = 0;
+   tempData->cfsGranularityMS = 0;
+   tempData->deviceChannels = 0;
+   tempData->diskOrderCode = DISK_ORDER_FIFO_CODE;
+   tempData->diskSeekRate = 0;
+   tempData->contextSwitchMS = 0;
+   tempData->dispatchLatencyMS = 0;
+   tempData->interruptCostMS = 0;
+   tempData->memPlacementCode = PLACE_FIRST_FIT_CODE;
+   tempData->pageSize = 0;
+   tempData->pageLevelCount = 2;
+   tempData->tlbEntryCount = 16;
+   tempData->tlbPolicyCode = TLB_LRU_CODE;
+   tempData->tlbMissCycles = 0;
+   tempData->pageWalkCycles = 1;
+   tempData->residentFrameCount = 0;
+   tempData->pageReplaceCode = PAGE_FIFO_CODE;
+   tempData->workingSetMS = 100;
+   tempData->thrashPercent = 50;
+   
+   // no device line read yet, the devices fall back to the I/O cycle time
+   //    and the device channels
+   deviceId = 0;
+   
+   while( deviceId < DEVICE_COUNT )
+   {
+      tempData->deviceTable[ deviceId ].inCycleRate = 0;
+      tempData->deviceTable[ deviceId ].outCycleRate = 0;
+      tempData->deviceTable[ deviceId ].channelCount = -1;
+      
+      deviceId++;
+   }
+   
+   // loop to the end line of the config data items
+   while( endLineFound == False )
    {
       
-      // get line leader, check for failure
-         // function: getLineTo
+      // get line leader (the end line has no colon and stops at the newline),
+      //    check for failure
+         // function: getLineTo, compareString
       if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
-          dataBuffer, IGNORE_LEADING_WS, dontStopAtNonPrintable ) != NO_ERR )
+          dataBuffer, IGNORE_LEADING_WS, stopAtNonPrintable ) != NO_ERR
+          && compareString( dataBuffer, "End Simulator Configuration File." )
+                                                                  != STR_EQ )
       {
          // free temp struct memory
             // function: free
@@ -195,30 +326,53 @@ Boolean getConfigData(char *fileName,
          // function: getDataLineCode
       dataLineCode = getDataLineCode( dataBuffer );
       
+      // check for end line found
+      if( dataLineCode == CFG_END_LINE_CODE )
+      {
+         // set flag to end loop
+         endLineFound = True;
+      }
       // check for data line found
-      if( dataLineCode != CFG_CORRUPT_PROMPT_ERR )
+      else if( dataLineCode != CFG_CORRUPT_PROMPT_ERR )
       {
          // get data value
          
-            // check for version number
-            if( dataLineCode == CFG_VERSION_CODE )
+            // check for version number or time scale
+            if( dataLineCode == CFG_VERSION_CODE
+                 || dataLineCode == CFG_TIME_SCALE_CODE )
             {
                // get version number
                   // function: fscanf
                fscanf( fileAccessPtr, "%lf", &doubleData );
             }      
             // otherwise, check for metaData or LogTo file namespace
-            //    or CPU Scheduling names (strings)
+            //    or CPU Scheduling or I/O timer names or MLFQ quanta
+            //    or disk order or memory placement or TLB replacement
+            //    or page replacement (strings)
             else if( dataLineCode == CFG_MD_FILE_NAME_CODE
                       || dataLineCode == CFG_LOG_FILE_NAME_CODE
                        || dataLineCode == CFG_CPU_SCHED_CODE
-                        || dataLineCode == CFG_LOG_TO_CODE )
+                        || dataLineCode == CFG_LOG_TO_CODE
+                         || dataLineCode == CFG_IO_TIMER_CODE
+                          || dataLineCode == CFG_MLFQ_QUANTA_CODE
+                           || dataLineCode == CFG_DISK_ORDER_CODE
+                            || dataLineCode == CFG_MEM_PLACEMENT_CODE
+                             || dataLineCode == CFG_TLB_POLICY_CODE
+                              || dataLineCode == CFG_PAGE_REPLACE_CODE )
             {
             
                // get string input
                   // function: fscanf
                fscanf( fileAccessPtr, "%s", dataBuffer );
             }      
+            // otherwise, check for a device line (rest of the line)
+            else if( dataLineCode == CFG_DEVICE_CODE )
+            {
+               // get string input to the end of the line
+                  // function: getLineTo
+               getLineTo( fileAccessPtr, MAX_STR_LEN, '\n',
+                   dataBuffer, IGNORE_LEADING_WS, stopAtNonPrintable );
+            }
             // otherwise, assume integer data
             else
             {
@@ -232,7 +386,8 @@ Boolean getConfigData(char *fileName,
                                                                   == True )
          {
             // assign to data pointer depending on config item
-               // function: getCpuSchedCode, getLogToCode
+               // function: getCpuSchedCode, getLogToCode, getIoTimerCode,
+               //    getDiskOrderCode, getDeviceConfig, getPlacementCode
             switch( dataLineCode )
             {
                case CFG_VERSION_CODE:
@@ -279,6 +434,139 @@ Boolean getConfigData(char *fileName,
                
                   copyString( tempData->logToFileName, dataBuffer );
                   break;
+                  
+               case CFG_TIME_SCALE_CODE:
+               
+                  tempData->timeScale = doubleData;
+                  break;
+                  
+               case CFG_IO_TIMER_CODE:
+               
+                  tempData->ioTimerCode = getIoTimerCode( dataBuffer );
+                  break;
+                  
+               case CFG_CPU_CORES_CODE:
+               
+                  tempData->cpuCoreCount = intData;
+                  break;
+                  
+               case CFG_HOST_THREADS_CODE:
+               
+                  tempData->hostThreadCount = intData;
+                  break;
+                  
+               case CFG_MLFQ_QUANTA_CODE:
+               
+                  tempData->mlfqLevelCount = getMlfqQuanta( dataBuffer,
+                                               tempData->mlfqQuantumArray );
+                  break;
+                  
+               case CFG_MLFQ_BOOST_CODE:
+               
+                  tempData->mlfqBoostMS = intData;
+                  break;
+                  
+               case CFG_CFS_LATENCY_CODE:
+               
+                  tempData->cfsLatencyMS = intData;
+                  break;
+                  
+               case CFG_CFS_GRANULARITY_CODE:
+               
+                  tempData->cfsGranularityMS = intData;
+                  break;
+                  
+               case CFG_DEVICE_CHANNELS_CODE:
+               
+                  tempData->deviceChannels = intData;
+                  break;
+                  
+               case CFG_DISK_ORDER_CODE:
+               
+                  tempData->diskOrderCode = getDiskOrderCode( dataBuffer );
+                  break;
+                  
+               case CFG_DISK_SEEK_CODE:
+               
+                  tempData->diskSeekRate = intData;
+                  break;
+                  
+               case CFG_DEVICE_CODE:
+               
+                  deviceId = getDeviceConfig( dataBuffer, &deviceConfig );
+                  tempData->deviceTable[ deviceId ] = deviceConfig;
+                  break;
+                  
+               case CFG_CONTEXT_SWITCH_CODE:
+               
+                  tempData->contextSwitchMS = intData;
+                  break;
+                  
+               case CFG_DISPATCH_LATENCY_CODE:
+               
+                  tempData->dispatchLatencyMS = intData;
+                  break;
+                  
+               case CFG_INTERRUPT_COST_CODE:
+               
+                  tempData->interruptCostMS = intData;
+                  break;
+                  
+               case CFG_MEM_PLACEMENT_CODE:
+               
+                  tempData->memPlacementCode = getPlacementCode( dataBuffer );
+                  break;
+                  
+               case CFG_PAGE_SIZE_CODE:
+               
+                  tempData->pageSize = intData;
+                  break;
+                  
+               case CFG_PAGE_LEVELS_CODE:
+               
+                  tempData->pageLevelCount = intData;
+                  break;
+                  
+               case CFG_TLB_ENTRIES_CODE:
+               
+                  tempData->tlbEntryCount = intData;
+                  break;
+                  
+               case CFG_TLB_POLICY_CODE:
+               
+                  tempData->tlbPolicyCode = getTlbPolicyCode( dataBuffer );
+                  break;
+                  
+               case CFG_TLB_MISS_CODE:
+               
+                  tempData->tlbMissCycles = intData;
+                  break;
+                  
+               case CFG_PAGE_WALK_CODE:
+               
+                  tempData->pageWalkCycles = intData;
+                  break;
+                  
+               case CFG_RESIDENT_FRAMES_CODE:
+               
+                  tempData->residentFrameCount = intData;
+                  break;
+                  
+               case CFG_PAGE_REPLACE_CODE:
+               
+                  tempData->pageReplaceCode =
+                                        getPageReplaceCode( dataBuffer );
+                  break;
+                  
+               case CFG_WORKING_SET_CODE:
+               
+                  tempData->workingSetMS = intData;
+                  break;
+                  
+               case CFG_THRASH_RATE_CODE:
+               
+                  tempData->thrashPercent = intData;
+                  break;
             }
          }      
          // otherwise, assume data value not in range
@@ -318,17 +606,17 @@ Boolean getConfigData(char *fileName,
          // return corrupt config file code
          return False;
       }   
-      // increment line counter
-      lineCtr++;
+      // check for a required data line (optional lines follow the log file)
+      if( dataLineCode <= CFG_LOG_FILE_NAME_CODE )
+      {
+         // increment line counter
+         lineCtr++;
+      }
    }
    // end master loop
    
-   // acquire end of sim config string
-      // function: getLineTo
-   if( getLineTo( fileAccessPtr, MAX_STR_LEN, PERIOD,
-       dataBuffer, IGNORE_LEADING_WS, dontStopAtNonPrintable ) != NO_ERR
-       || compareString( dataBuffer, "End Simulator Configuration File" )
-                                                                  != STR_EQ )
+   // check that all required data lines were found before the end line
+   if( lineCtr < NUM_DATA_LINES )
    {
       // free temp struct memory
          // function: free
@@ -345,6 +633,63 @@ Boolean getConfigData(char *fileName,
       // return corrupt file data
       return False;
    }   
+   // check for no MLFQ quanta given
+   if( tempData->mlfqLevelCount == 0 )
+   {
+      // start at the quantum time, doubling it at each level down
+      tempData->mlfqLevelCount = MLFQ_DEFAULT_LEVELS;
+      tempData->mlfqQuantumArray[ 0 ] = tempData->quantumCycles;
+      levelIndex = 1;
+      
+      while( levelIndex < MLFQ_DEFAULT_LEVELS )
+      {
+         tempData->mlfqQuantumArray[ levelIndex ] =
+                         tempData->mlfqQuantumArray[ levelIndex - 1 ] * 2;
+         
+         levelIndex++;
+      }
+   }
+   
+   // fill in the device settings no device line gave
+   deviceId = 0;
+   
+   while( deviceId < DEVICE_COUNT )
+   {
+      if( tempData->deviceTable[ deviceId ].inCycleRate == 0 )
+      {
+         tempData->deviceTable[ deviceId ].inCycleRate = tempData->ioCycleRate;
+         tempData->deviceTable[ deviceId ].outCycleRate =
+                                                       tempData->ioCycleRate;
+      }
+      
+      if( tempData->deviceTable[ deviceId ].channelCount < 0 )
+      {
+         tempData->deviceTable[ deviceId ].channelCount =
+                                                    tempData->deviceChannels;
+      }
+      
+      deviceId++;
+   }
+   
+   // check for no CFS granularity given, use one cycle
+   if( tempData->cfsGranularityMS == 0 )
+   {
+      tempData->cfsGranularityMS = tempData->procCycleRate;
+   }
+   
+   // check for no CFS latency given, use four quanta
+   if( tempData->cfsLatencyMS == 0 )
+   {
+      tempData->cfsLatencyMS = tempData->quantumCycles
+                                          * tempData->procCycleRate * 4;
+   }
+   
+   // the latency is never below the granularity
+   if( tempData->cfsLatencyMS < tempData->cfsGranularityMS )
+   {
+      tempData->cfsLatencyMS = tempData->cfsGranularityMS;
+   }
+   
    // assign temporary pointer to parameter return pointer
    *configData = tempData;
    
@@ -370,49 +715,15 @@ ConfigCpuDataCodes getCpuSchedCode( char *codeStr )
 {
    // initialize variables
    
-      // set up temporary string for testing
-         // function: getStringLength, malloc
-      int strLen = getStringLength( codeStr );
-      char *tempStr = (char *)malloc( strLen + 1);
+      // look the name up in the scheduler registry
+         // function: findSchedulerCode
+      int returnVal = findSchedulerCode( codeStr );
       
-      // set default to FCFS-NULL
-      int returnVal = CPU_SCHED_FCFS_N_CODE;
-
-   // set string to lower case for testing
-      // function: setStrToLowerCase
-   setStrToLowerCase( tempStr, codeStr );
-
-   // check for SJF-N
-      // function: compareString
-   if( compareString( tempStr, "sjf-n" ) == STR_EQ )
-   {      
-      // set return code to sjf
-      returnVal = CPU_SCHED_SJF_N_CODE;
-   }   
-   // check for SRTF-P
-      // function: compareString
-   if( compareString( tempStr, "srtf-p" ) == STR_EQ )
-   {      
-      // set return code to srtf
-      returnVal = CPU_SCHED_SRTF_P_CODE;
-   }   
-   // check for FCFS-P
-      // function: compareString
-   if( compareString( tempStr, "fcfs-p" ) == STR_EQ )
+   // check for an unknown name, set default to FCFS-NULL
+   if( returnVal < 0 )
    {
-      // set return code to fcfs
-      returnVal = CPU_SCHED_FCFS_P_CODE;
-   }   
-   // check for RR-P
-      // function: compareString
-   if( compareString( tempStr, "rr-p" ) == STR_EQ )   
-   {
-      // set return code to rr
-      returnVal = CPU_SCHED_RR_P_CODE;
+      returnVal = CPU_SCHED_FCFS_N_CODE;
    }
-   // free temp string memory
-      // function: free
-   free( tempStr );
    
    // return resulting value
    return returnVal;
@@ -471,6 +782,115 @@ int getDataLineCode( char *dataBuffer )
    {
       return CFG_LOG_FILE_NAME_CODE;
    }
+   if( compareString( dataBuffer, "Time Scale" ) == STR_EQ )
+   {
+      return CFG_TIME_SCALE_CODE;
+   }
+   if( compareString( dataBuffer, "I/O Timer" ) == STR_EQ )
+   {
+      return CFG_IO_TIMER_CODE;
+   }
+   if( compareString( dataBuffer, "CPU Cores" ) == STR_EQ )
+   {
+      return CFG_CPU_CORES_CODE;
+   }
+   if( compareString( dataBuffer, "Host Threads" ) == STR_EQ )
+   {
+      return CFG_HOST_THREADS_CODE;
+   }
+   if( compareString( dataBuffer, "MLFQ Quanta (cycles)" ) == STR_EQ )
+   {
+      return CFG_MLFQ_QUANTA_CODE;
+   }
+   if( compareString( dataBuffer, "MLFQ Boost (msec)" ) == STR_EQ )
+   {
+      return CFG_MLFQ_BOOST_CODE;
+   }
+   if( compareString( dataBuffer, "CFS Latency (msec)" ) == STR_EQ )
+   {
+      return CFG_CFS_LATENCY_CODE;
+   }
+   if( compareString( dataBuffer, "CFS Granularity (msec)" ) == STR_EQ )
+   {
+      return CFG_CFS_GRANULARITY_CODE;
+   }
+   if( compareString( dataBuffer, "Device Channels" ) == STR_EQ )
+   {
+      return CFG_DEVICE_CHANNELS_CODE;
+   }
+   if( compareString( dataBuffer, "Disk Order" ) == STR_EQ )
+   {
+      return CFG_DISK_ORDER_CODE;
+   }
+   if( compareString( dataBuffer, "Disk Seek (msec/100 tracks)" ) == STR_EQ )
+   {
+      return CFG_DISK_SEEK_CODE;
+   }
+   if( compareString( dataBuffer, "Device" ) == STR_EQ )
+   {
+      return CFG_DEVICE_CODE;
+   }
+   if( compareString( dataBuffer, "Context Switch (msec)" ) == STR_EQ )
+   {
+      return CFG_CONTEXT_SWITCH_CODE;
+   }
+   if( compareString( dataBuffer, "Dispatch Latency (msec)" ) == STR_EQ )
+   {
+      return CFG_DISPATCH_LATENCY_CODE;
+   }
+   if( compareString( dataBuffer, "Interrupt Cost (msec)" ) == STR_EQ )
+   {
+      return CFG_INTERRUPT_COST_CODE;
+   }
+   if( compareString( dataBuffer, "Memory Placement" ) == STR_EQ )
+   {
+      return CFG_MEM_PLACEMENT_CODE;
+   }
+   if( compareString( dataBuffer, "Page Size (KB)" ) == STR_EQ )
+   {
+      return CFG_PAGE_SIZE_CODE;
+   }
+   if( compareString( dataBuffer, "Page Table Levels" ) == STR_EQ )
+   {
+      return CFG_PAGE_LEVELS_CODE;
+   }
+   if( compareString( dataBuffer, "TLB Entries" ) == STR_EQ )
+   {
+      return CFG_TLB_ENTRIES_CODE;
+   }
+   if( compareString( dataBuffer, "TLB Replacement" ) == STR_EQ )
+   {
+      return CFG_TLB_POLICY_CODE;
+   }
+   if( compareString( dataBuffer, "TLB Miss Cost (cycles)" ) == STR_EQ )
+   {
+      return CFG_TLB_MISS_CODE;
+   }
+   if( compareString( dataBuffer, "Page Walk Cost (cycles)" ) == STR_EQ )
+   {
+      return CFG_PAGE_WALK_CODE;
+   }
+   if( compareString( dataBuffer, "Resident Frames" ) == STR_EQ )
+   {
+      return CFG_RESIDENT_FRAMES_CODE;
+   }
+   if( compareString( dataBuffer, "Page Replacement" ) == STR_EQ )
+   {
+      return CFG_PAGE_REPLACE_CODE;
+   }
+   if( compareString( dataBuffer, "Working Set (msec)" ) == STR_EQ )
+   {
+      return CFG_WORKING_SET_CODE;
+   }
+   if( compareString( dataBuffer, "Thrashing Fault Rate (%)" ) == STR_EQ )
+   {
+      return CFG_THRASH_RATE_CODE;
+   }
+   if( compareString( dataBuffer, "End Simulator Configuration File." ) 
+                                                                  == STR_EQ )
+   {
+      return CFG_END_LINE_CODE;
+   }
       
    return CFG_CORRUPT_PROMPT_ERR;
 }
@@ -523,63 +943,529 @@ ConfigLogDataCodes getLogToCode( char *logToStr )
    return returnVal;
 }
 
-
 /*
-Funtion name: valueInRange
-Algorithm: tests one of three values (int, double, string) for being
-           in specified range, depending on data code
-           (i.e., specified config value)
-Precondition: one of three data values is valid
-Postcondiditon: returns True if data is within specified parameters,
-                false otherwise
-Exceptions: metadata or logfile names are ignored and return True
-Notes: none
+Funtion name: getIoTimerCode
+Algorithm: converts string data (e.g., "Heap", "Wheel")
+           to constant code number to be stored as integer
+Precondition: ioTimerStr is a C-Style string with one
+              of the specified I/O timer names
+Postcondiditon: returns the code representing the I/O timer
+Exceptions: defaults to heap code
+Note: none
 */
-Boolean valueInRange( int lineCode, int intVal,
-                                       double doubleVal, char *stringVal )
+ConfigIoTimerCodes getIoTimerCode( char *ioTimerStr )
 {
    // initialize function variables
-   Boolean result = True;
-   char *tempStr;
-   int strLen;
    
-   // use line code to identify prompt line
-   switch( lineCode )
-   {
-      // version code
-      case CFG_VERSION_CODE:
+      // create temporary string
+         // function: getStringLength, malloc
+      int strLen = getStringLength( ioTimerStr );
+      char *tempStr = (char *)malloc( strLen + 1);
       
-         // check if limits of version code are exceeded
-         if( doubleVal < 0.00 || doubleVal > 10.00 )
-         {
-            // set Boolean result to false
-            result = False;
-         }
-         break;
-         
-      // for CPU scheduling code
-      case CFG_CPU_SCHED_CODE:
+      // set default to the event heap
+      int returnVal = IO_TIMER_HEAP_CODE;
       
-         // create temporary string and set to lower case
-            // function: getStringLength, malloc, setStrToLowerCase
-         strLen = getStringLength( stringVal );
-         tempStr = (char *)malloc( strLen + 1);
-         setStrToLowerCase( tempStr, stringVal );
-         
-         // check for not finding one of the scheduling strings
-            // function: compareString
-         if( compareString( tempStr, "fcfs-n" ) != STR_EQ
-         && compareString( tempStr, "sjf-n" ) != STR_EQ
-         && compareString( tempStr, "srtf-p" ) != STR_EQ
-         && compareString( tempStr, "fcfs-p" ) != STR_EQ
-         && compareString( tempStr, "rr-p" ) != STR_EQ )
+   // set temp string to lowercase
+      // function: setStrToLowerCase
+   setStrToLowerCase( tempStr, ioTimerStr );
+   
+   // check for WHEEL
+      // function: compareString
+   if( compareString( tempStr, "wheel" ) == STR_EQ )
+   {
+      // set return value to wheel code
+      returnVal = IO_TIMER_WHEEL_CODE;
+   }
+   // return temp string memory
+      // function: free
+   free( tempStr );
+   
+   // return found code
+   return returnVal;
+}
+
+/*
+Funtion name: getPlacementCode
+Algorithm: converts string data (e.g., "Best-Fit", "Buddy")
+           to constant code number to be stored as integer
+Precondition: placementStr is a C-Style string with one
+              of the memory placement names
+Postcondiditon: returns the memory placement code
+Exceptions: defaults to first fit
+Note: none
+*/
+ConfigPlacementCodes getPlacementCode( char *placementStr )
+{
+   // initialize function variables
+   
+      // create temporary string
+         // function: getStringLength, malloc
+      int strLen = getStringLength( placementStr );
+      char *tempStr = (char *)malloc( strLen + 1);
+      
+      // set default to first fit
+      int returnVal = PLACE_FIRST_FIT_CODE;
+      
+   // set temp string to lowercase
+      // function: setStrToLowerCase
+   setStrToLowerCase( tempStr, placementStr );
+   
+   // check for best fit
+      // function: compareString
+   if( compareString( tempStr, "best-fit" ) == STR_EQ )
+   {
+      // set return value to best fit code
+      returnVal = PLACE_BEST_FIT_CODE;
+   }
+   // check for next fit
+      // function: compareString
+   if( compareString( tempStr, "next-fit" ) == STR_EQ )
+   {
+      // set return value to next fit code
+      returnVal = PLACE_NEXT_FIT_CODE;
+   }
+   // check for buddy
+      // function: compareString
+   if( compareString( tempStr, "buddy" ) == STR_EQ )
+   {
+      // set return value to buddy code
+      returnVal = PLACE_BUDDY_CODE;
+   }
+   // return temp string memory
+      // function: free
+   free( tempStr );
+   
+   // return found code
+   return returnVal;
+}
+
+/*
+Funtion name: getPlacementName
+Algorithm: returns the config name of a memory placement code
+Precondition: code is one of the memory placement codes
+Postcondiditon: returns a constant string
+Exceptions: none
+Note: none
+*/
+char *getPlacementName( int placementCode )
+{
+   // check for each code
+   if( placementCode == PLACE_BEST_FIT_CODE )
+   {
+      return "Best-Fit";
+   }
+   if( placementCode == PLACE_NEXT_FIT_CODE )
+   {
+      return "Next-Fit";
+   }
+   if( placementCode == PLACE_BUDDY_CODE )
+   {
+      return "Buddy";
+   }
+   
+   return "First-Fit";
+}
+
+/*
+Funtion name: getTlbPolicyCode
+Algorithm: converts string data (e.g., "LRU", "Random")
+           to constant code number to be stored as integer
+Precondition: tlbPolicyStr is a C-Style string with one
+              of the TLB replacement names
+Postcondiditon: returns the TLB replacement code
+Exceptions: defaults to LRU
+Note: none
+*/
+ConfigTlbPolicyCodes getTlbPolicyCode( char *tlbPolicyStr )
+{
+   // initialize function variables
+   
+      // create temporary string
+         // function: getStringLength, malloc
+      int strLen = getStringLength( tlbPolicyStr );
+      char *tempStr = (char *)malloc( strLen + 1);
+      
+      // set default to LRU
+      int returnVal = TLB_LRU_CODE;
+      
+   // set temp string to lowercase
+      // function: setStrToLowerCase
+   setStrToLowerCase( tempStr, tlbPolicyStr );
+   
+   // check for random
+      // function: compareString
+   if( compareString( tempStr, "random" ) == STR_EQ )
+   {
+      // set return value to random code
+      returnVal = TLB_RANDOM_CODE;
+   }
+   // return temp string memory
+      // function: free
+   free( tempStr );
+   
+   // return found code
+   return returnVal;
+}
+
+/*
+Funtion name: getTlbPolicyName
+Algorithm: returns the config name of a TLB replacement code
+Precondition: code is one of the TLB replacement codes
+Postcondiditon: returns a constant string
+Exceptions: none
+Note: none
+*/
+char *getTlbPolicyName( int tlbPolicyCode )
+{
+   // check for random
+   if( tlbPolicyCode == TLB_RANDOM_CODE )
+   {
+      return "Random";
+   }
+   
+   return "LRU";
+}
+
+/*
+Funtion name: getPageReplaceCode
+Algorithm: converts string data (e.g., "FIFO", "LRU", "Clock", "WSClock")
+           to constant code number to be stored as integer
+Precondition: pageReplaceStr is a C-Style string with one
+              of the page replacement names
+Postcondiditon: returns the page replacement code
+Exceptions: defaults to FIFO
+Note: none
+*/
+ConfigPageReplaceCodes getPageReplaceCode( char *pageReplaceStr )
+{
+   // initialize function variables
+   
+      // create temporary string
+         // function: getStringLength, malloc
+      int strLen = getStringLength( pageReplaceStr );
+      char *tempStr = (char *)malloc( strLen + 1);
+      
+      // set default to FIFO
+      int returnVal = PAGE_FIFO_CODE;
+      
+   // set temp string to lowercase
+      // function: setStrToLowerCase
+   setStrToLowerCase( tempStr, pageReplaceStr );
+   
+   // check for LRU
+      // function: compareString
+   if( compareString( tempStr, "lru" ) == STR_EQ )
+   {
+      // set return value to LRU code
+      returnVal = PAGE_LRU_CODE;
+   }
+   // check for clock
+   else if( compareString( tempStr, "clock" ) == STR_EQ )
+   {
+      // set return value to clock code
+      returnVal = PAGE_CLOCK_CODE;
+   }
+   // check for working set clock
+   else if( compareString( tempStr, "wsclock" ) == STR_EQ )
+   {
+      // set return value to working set clock code
+      returnVal = PAGE_WSCLOCK_CODE;
+   }
+   // return temp string memory
+      // function: free
+   free( tempStr );
+   
+   // return found code
+   return returnVal;
+}
+
+/*
+Funtion name: getPageReplaceName
+Algorithm: returns the config name of a page replacement code
+Precondition: code is one of the page replacement codes
+Postcondiditon: returns a constant string
+Exceptions: none
+Note: none
+*/
+char *getPageReplaceName( int pageReplaceCode )
+{
+   // check for LRU
+   if( pageReplaceCode == PAGE_LRU_CODE )
+   {
+      return "LRU";
+   }
+   
+   // check for clock
+   if( pageReplaceCode == PAGE_CLOCK_CODE )
+   {
+      return "Clock";
+   }
+   
+   // check for working set clock
+   if( pageReplaceCode == PAGE_WSCLOCK_CODE )
+   {
+      return "WSClock";
+   }
+   
+   return "FIFO";
+}
+
+/*
+Funtion name: getDiskOrderCode
+Algorithm: converts string data (e.g., "FIFO", "SCAN", "C-LOOK")
+           to constant code number to be stored as integer
+Precondition: diskOrderStr is a C-Style string with one
+              of the specified disk service orders
+Postcondiditon: returns the code representing the disk service order
+Exceptions: defaults to fifo code
+Note: none
+*/
+ConfigDiskOrderCodes getDiskOrderCode( char *diskOrderStr )
+{
+   // initialize function variables
+   
+      // create temporary string
+         // function: getStringLength, malloc
+      int strLen = getStringLength( diskOrderStr );
+      char *tempStr = (char *)malloc( strLen + 1);
+      
+      // set default to first in first out
+      int returnVal = DISK_ORDER_FIFO_CODE;
+      
+   // set temp string to lowercase
+      // function: setStrToLowerCase
+   setStrToLowerCase( tempStr, diskOrderStr );
+   
+   // check for SCAN
+      // function: compareString
+   if( compareString( tempStr, "scan" ) == STR_EQ )
+   {
+      // set return value to scan code
+      returnVal = DISK_ORDER_SCAN_CODE;
+   }
+   // check for C-LOOK
+      // function: compareString
+   if( compareString( tempStr, "c-look" ) == STR_EQ )
+   {
+      // set return value to c-look code
+      returnVal = DISK_ORDER_CLOOK_CODE;
+   }
+   // return temp string memory
+      // function: free
+   free( tempStr );
+   
+   // return found code
+   return returnVal;
+}
+
+/*
+Funtion name: getDeviceConfig
+Algorithm: reads a device line (e.g., "hard drive, 10, 2, 12, 8") as the
+           device name and its cycle time, then optionally its channel
+           count, then optionally its input and output cycle times
+Precondition: deviceStr is a C-Style string
+Postcondiditon: returns the device id of the name, the device settings
+                hold the line's values
+Exceptions: returns -1 for an unknown device, a bad number, a cycle time
+            out of range or text left over
+Note: a channel count left out is -1 and set from the device channels
+*/
+int getDeviceConfig( char *deviceStr, DeviceConfig *deviceConfig )
+{
+   // initialize function variables
+   char deviceName[ MAX_STR_LEN ];
+   int charIndex = 0;
+   int deviceId, cycleRate;
+   int strLen = getStringLength( deviceStr );
+   
+   // check for a line ending in a comma, its last number is missing
+   while( strLen > 0 && deviceStr[ strLen - 1 ] <= SPACE )
+   {
+      strLen--;
+   }
+   
+   if( strLen == 0 || deviceStr[ strLen - 1 ] == COMMA )
+   {
+      return -1;
+   }
+   
+   // get the device name and resolve it to its id
+      // function: getStringArg, findDeviceId
+   charIndex = getStringArg( deviceName, deviceStr, charIndex );
+   deviceId = findDeviceId( deviceName );
+   
+   // check for an unknown device or no cycle time
+   if( deviceId < 0 || deviceStr[ charIndex ] != COMMA )
+   {
+      return -1;
+   }
+   
+   // get the cycle time, used both ways unless the line splits it
+      // function: getNumberArg
+   charIndex = getNumberArg( &cycleRate, deviceStr, charIndex );
+   deviceConfig->inCycleRate = cycleRate;
+   deviceConfig->outCycleRate = cycleRate;
+   deviceConfig->channelCount = -1;
+   
+   // check for the optional channel count
+   if( deviceStr[ charIndex ] == COMMA )
+   {
+      // function: getNumberArg
+      charIndex = getNumberArg( &deviceConfig->channelCount, deviceStr,
+                                                                 charIndex );
+      
+      // check for the optional input and output cycle times, as a pair
+      if( deviceStr[ charIndex ] == COMMA )
+      {
+         // function: getNumberArg
+         charIndex = getNumberArg( &deviceConfig->inCycleRate, deviceStr,
+                                                                 charIndex );
+         
+         if( deviceStr[ charIndex ] != COMMA )
+         {
+            return -1;
+         }
+         
+         charIndex = getNumberArg( &deviceConfig->outCycleRate, deviceStr,
+                                                                 charIndex );
+      }
+      
+      // check for a bad channel count
+      if( deviceConfig->channelCount < 0
+                                      || deviceConfig->channelCount > 1000 )
+      {
+         return -1;
+      }
+   }
+   
+   // skip trailing white space
+   while( deviceStr[ charIndex ] == SPACE )
+   {
+      charIndex++;
+   }
+   
+   // check for text left over or cycle times out of range
+   if( deviceStr[ charIndex ] != NULL_CHAR
+        || deviceConfig->inCycleRate < 1 || deviceConfig->inCycleRate > 1000
+        || deviceConfig->outCycleRate < 1
+        || deviceConfig->outCycleRate > 1000 )
+   {
+      return -1;
+   }
+   
+   return deviceId;
+}
+
+/*
+Funtion name: getMlfqQuanta
+Algorithm: converts a comma separated list of quantum times (e.g., "2,4,8")
+           to one quantum per MLFQ level, top level first
+Precondition: quantumArray holds MLFQ_MAX_LEVELS items
+Postcondiditon: returns the number of levels read
+Exceptions: returns zero for an empty list, a quantum below one, a
+            character other than a digit or comma, or too many levels
+Note: none
+*/
+int getMlfqQuanta( char *quantaStr, int *quantumArray )
+{
+   // initialize function variables
+   int charIndex = 0;
+   int levelCount = 0;
+   int quantumValue = 0;
+   Boolean digitFound = False;
+   
+   // loop to the end of the string
+   while( quantaStr[ charIndex ] != NULL_CHAR )
+   {
+      // check for a digit
+      if( quantaStr[ charIndex ] >= '0' && quantaStr[ charIndex ] <= '9' )
+      {
+         // add the digit, stopping at absurd values
+         quantumValue = quantumValue * 10 + ( quantaStr[ charIndex ] - '0' );
+         digitFound = True;
+         
+         if( quantumValue > 100000 )
+         {
+            return 0;
+         }
+      }
+      // otherwise, check for the end of one quantum
+      else if( quantaStr[ charIndex ] == COMMA
+                && digitFound == True && quantumValue > 0
+                 && levelCount < MLFQ_MAX_LEVELS )
+      {
+         quantumArray[ levelCount ] = quantumValue;
+         levelCount++;
+         
+         quantumValue = 0;
+         digitFound = False;
+      }
+      // otherwise, assume a bad list
+      else
+      {
+         return 0;
+      }
+      
+      charIndex++;
+   }
+   
+   // check for a good last quantum
+   if( digitFound == False || quantumValue == 0
+                                        || levelCount == MLFQ_MAX_LEVELS )
+   {
+      return 0;
+   }
+   
+   quantumArray[ levelCount ] = quantumValue;
+   
+   return levelCount + 1;
+}
+
+/*
+Funtion name: valueInRange
+Algorithm: tests one of three values (int, double, string) for being
+           in specified range, depending on data code
+           (i.e., specified config value)
+Precondition: one of three data values is valid
+Postcondiditon: returns True if data is within specified parameters,
+                false otherwise
+Exceptions: metadata or logfile names are ignored and return True
+Notes: none
+*/
+Boolean valueInRange( int lineCode, int intVal,
+                                       double doubleVal, char *stringVal )
+{
+   // initialize function variables
+   Boolean result = True;
+   char *tempStr;
+   int strLen;
+   int quantumArray[ MLFQ_MAX_LEVELS ];
+   DeviceConfig deviceConfig;
+   
+   // use line code to identify prompt line
+   switch( lineCode )
+   {
+      // version code
+      case CFG_VERSION_CODE:
+      
+         // check if limits of version code are exceeded
+         if( doubleVal < 0.00 || doubleVal > 10.00 )
+         {
+            // set Boolean result to false
+            result = False;
+         }
+         break;
+         
+      // for CPU scheduling code
+      case CFG_CPU_SCHED_CODE:
+      
+         // check for a name missing from the scheduler registry
+            // function: findSchedulerCode
+         if( findSchedulerCode( stringVal ) < 0 )
          {
             // set Boolean result to false
             result = False;
          }   
-         // free temp string memory
-            // function: free
-         free( tempStr );
          
          break;
       // for quantum cycles
@@ -625,6 +1511,83 @@ Boolean valueInRange( int lineCode, int intVal,
             result = False;
          }   
          
+         break;
+      // for MLFQ quanta
+      case CFG_MLFQ_QUANTA_CODE:
+      
+         // check for a bad list of quanta
+            // function: getMlfqQuanta
+         if( getMlfqQuanta( stringVal, quantumArray ) == 0 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for MLFQ boost time or CFS times
+      case CFG_MLFQ_BOOST_CODE:
+      case CFG_CFS_LATENCY_CODE:
+      case CFG_CFS_GRANULARITY_CODE:
+      
+         // check for time limits exceeded
+         if( intVal < 0 || intVal > 1000000 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for device channels, disk seek time or the overhead costs
+      case CFG_DEVICE_CHANNELS_CODE:
+      case CFG_DISK_SEEK_CODE:
+      case CFG_CONTEXT_SWITCH_CODE:
+      case CFG_DISPATCH_LATENCY_CODE:
+      case CFG_INTERRUPT_COST_CODE:
+      case CFG_TLB_MISS_CODE:
+      case CFG_PAGE_WALK_CODE:
+      
+         // check for limits exceeded, zero channels is unlimited
+         if( intVal < 0 || intVal > 1000 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for a device line
+      case CFG_DEVICE_CODE:
+      
+         // check for an unknown device or a bad setting
+            // function: getDeviceConfig
+         if( getDeviceConfig( stringVal, &deviceConfig ) < 0 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for CPU cores or host threads
+      case CFG_CPU_CORES_CODE:
+      case CFG_HOST_THREADS_CODE:
+      
+         // check for count limits exceeded
+         if( intVal < 1 || intVal > 64 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for time scale
+      case CFG_TIME_SCALE_CODE:
+      
+         // check for time scale limits exceeded
+         if( doubleVal <= 0.00 || doubleVal > 100.00 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
          break;
       // for log to operation
       case CFG_LOG_TO_CODE:
@@ -647,6 +1610,189 @@ Boolean valueInRange( int lineCode, int intVal,
          // free temp string memory
             // function: free
          free( tempStr );
+         
+         break;
+      // for I/O timer
+      case CFG_IO_TIMER_CODE:
+      
+         // create temporary string and set it to lower case
+            // function: getStringLength, malloc, setStrToLowerCase
+         strLen = getStringLength( stringVal );
+         tempStr = (char *)malloc( strLen + 1);
+         setStrToLowerCase( tempStr, stringVal );
+         
+         // check for not finding one of the I/O timer strings
+            // function: compareString
+         if( compareString( tempStr, "heap" ) != STR_EQ
+         && compareString( tempStr, "wheel" ) != STR_EQ )
+         {
+            // set boolean result to false
+            result = False;
+         }   
+         // free temp string memory
+            // function: free
+         free( tempStr );
+         
+         break;
+      // for disk order
+      case CFG_DISK_ORDER_CODE:
+      
+         // create temporary string and set it to lower case
+            // function: getStringLength, malloc, setStrToLowerCase
+         strLen = getStringLength( stringVal );
+         tempStr = (char *)malloc( strLen + 1);
+         setStrToLowerCase( tempStr, stringVal );
+         
+         // check for not finding one of the disk order strings
+            // function: compareString
+         if( compareString( tempStr, "fifo" ) != STR_EQ
+         && compareString( tempStr, "scan" ) != STR_EQ
+         && compareString( tempStr, "c-look" ) != STR_EQ )
+         {
+            // set boolean result to false
+            result = False;
+         }   
+         // free temp string memory
+            // function: free
+         free( tempStr );
+         
+         break;
+      // for memory placement
+      case CFG_MEM_PLACEMENT_CODE:
+      
+         // create temporary string and set it to lower case
+            // function: getStringLength, malloc, setStrToLowerCase
+         strLen = getStringLength( stringVal );
+         tempStr = (char *)malloc( strLen + 1);
+         setStrToLowerCase( tempStr, stringVal );
+         
+         // check for not finding one of the placement strings
+            // function: compareString
+         if( compareString( tempStr, "first-fit" ) != STR_EQ
+         && compareString( tempStr, "best-fit" ) != STR_EQ
+         && compareString( tempStr, "next-fit" ) != STR_EQ
+         && compareString( tempStr, "buddy" ) != STR_EQ )
+         {
+            // set boolean result to false
+            result = False;
+         }   
+         // free temp string memory
+            // function: free
+         free( tempStr );
+         
+         break;
+      // for page size
+      case CFG_PAGE_SIZE_CODE:
+      
+         // check for a size other than zero ( no paging ) or a power of
+         //    two up to 4096
+         if( intVal < 0 || intVal > 4096
+                                  || ( intVal & ( intVal - 1 ) ) != 0 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for page table levels
+      case CFG_PAGE_LEVELS_CODE:
+      
+         // check for levels limits exceeded
+         if( intVal < 1 || intVal > 4 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for TLB entries
+      case CFG_TLB_ENTRIES_CODE:
+      
+         // check for entries limits exceeded
+         if( intVal < 1 || intVal > 1024 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for TLB replacement
+      case CFG_TLB_POLICY_CODE:
+      
+         // create temporary string and set it to lower case
+            // function: getStringLength, malloc, setStrToLowerCase
+         strLen = getStringLength( stringVal );
+         tempStr = (char *)malloc( strLen + 1);
+         setStrToLowerCase( tempStr, stringVal );
+         
+         // check for not finding one of the TLB replacement strings
+            // function: compareString
+         if( compareString( tempStr, "lru" ) != STR_EQ
+         && compareString( tempStr, "random" ) != STR_EQ )
+         {
+            // set boolean result to false
+            result = False;
+         }   
+         // free temp string memory
+            // function: free
+         free( tempStr );
+         
+         break;
+      // for resident frames
+      case CFG_RESIDENT_FRAMES_CODE:
+      
+         // check for frames limits exceeded, zero is a frame per page
+         if( intVal < 0 || intVal > 1000000 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for page replacement
+      case CFG_PAGE_REPLACE_CODE:
+      
+         // create temporary string and set it to lower case
+            // function: getStringLength, malloc, setStrToLowerCase
+         strLen = getStringLength( stringVal );
+         tempStr = (char *)malloc( strLen + 1);
+         setStrToLowerCase( tempStr, stringVal );
+         
+         // check for not finding one of the page replacement strings
+            // function: compareString
+         if( compareString( tempStr, "fifo" ) != STR_EQ
+         && compareString( tempStr, "lru" ) != STR_EQ
+         && compareString( tempStr, "clock" ) != STR_EQ
+         && compareString( tempStr, "wsclock" ) != STR_EQ )
+         {
+            // set boolean result to false
+            result = False;
+         }   
+         // free temp string memory
+            // function: free
+         free( tempStr );
+         
+         break;
+      // for the working set window
+      case CFG_WORKING_SET_CODE:
+      
+         // check for time limits exceeded
+         if( intVal < 1 || intVal > 1000000 )
+         {
+            // set boolean result to false
+            result = False;
+         }
+         
+         break;
+      // for the thrashing fault rate
+      case CFG_THRASH_RATE_CODE:
+      
+         // check for percent limits exceeded
+         if( intVal < 1 || intVal > 100 )
+         {
+            // set boolean result to false
+            result = False;
+         }
    }         
    // return result of limits analysis
             
@@ -20,7 +20,34 @@ typedef enum { CFG_FILE_ACCESS_ERR = 3,
                CFG_PROC_CYCLES_CODE,
                CFG_IO_CYCLES_CODE,
                CFG_LOG_TO_CODE,
-               CFG_LOG_FILE_NAME_CODE } ConfigCodeMessages;
+               CFG_LOG_FILE_NAME_CODE,
+               CFG_TIME_SCALE_CODE,
+               CFG_IO_TIMER_CODE,
+               CFG_CPU_CORES_CODE,
+               CFG_HOST_THREADS_CODE,
+               CFG_MLFQ_QUANTA_CODE,
+               CFG_MLFQ_BOOST_CODE,
+               CFG_CFS_LATENCY_CODE,
+               CFG_CFS_GRANULARITY_CODE,
+               CFG_DEVICE_CHANNELS_CODE,
+               CFG_DISK_ORDER_CODE,
+               CFG_DISK_SEEK_CODE,
+               CFG_DEVICE_CODE,
+               CFG_CONTEXT_SWITCH_CODE,
+               CFG_DISPATCH_LATENCY_CODE,
+               CFG_INTERRUPT_COST_CODE,
+               CFG_MEM_PLACEMENT_CODE,
+               CFG_PAGE_SIZE_CODE,
+               CFG_PAGE_LEVELS_CODE,
+               CFG_TLB_ENTRIES_CODE,
+               CFG_TLB_POLICY_CODE,
+               CFG_TLB_MISS_CODE,
+               CFG_PAGE_WALK_CODE,
+               CFG_RESIDENT_FRAMES_CODE,
+               CFG_PAGE_REPLACE_CODE,
+               CFG_WORKING_SET_CODE,
+               CFG_THRASH_RATE_CODE,
+               CFG_END_LINE_CODE } ConfigCodeMessages;
                
 typedef enum { CPU_SCHED_SJF_N_CODE,
                CPU_SCHED_SRTF_P_CODE,
@@ -31,6 +58,54 @@ typedef enum { CPU_SCHED_SJF_N_CODE,
 typedef enum { LOGTO_MONITOR_CODE,
                LOGTO_FILE_CODE,
                LOGTO_BOTH_CODE } ConfigLogDataCodes;
+               
+typedef enum { IO_TIMER_HEAP_CODE,
+               IO_TIMER_WHEEL_CODE } ConfigIoTimerCodes;
+               
+typedef enum { DISK_ORDER_FIFO_CODE,
+               DISK_ORDER_SCAN_CODE,
+               DISK_ORDER_CLOOK_CODE } ConfigDiskOrderCodes;
+               
+typedef enum { PLACE_FIRST_FIT_CODE,
+               PLACE_BEST_FIT_CODE,
+               PLACE_NEXT_FIT_CODE,
+               PLACE_BUDDY_CODE } ConfigPlacementCodes;
+               
+typedef enum { TLB_LRU_CODE,
+               TLB_RANDOM_CODE } ConfigTlbPolicyCodes;
+               
+typedef enum { PAGE_FIFO_CODE,
+               PAGE_LRU_CODE,
+               PAGE_CLOCK_CODE,
+               PAGE_WSCLOCK_CODE } ConfigPageReplaceCodes;
+               
+// devices a dev op can name, the dense device ids of the device table
+typedef enum { DEVICE_ETHERNET,
+               DEVICE_HARD_DRIVE,
+               DEVICE_KEYBOARD,
+               DEVICE_MONITOR,
+               DEVICE_PRINTER,
+               DEVICE_SERIAL,
+               DEVICE_SOUND_SIGNAL,
+               DEVICE_SWAP,
+               DEVICE_USB,
+               DEVICE_VIDEO_SIGNAL,
+               DEVICE_COUNT } ConfigDeviceCodes;
+               
+// timing and channels of one device, from its Device line
+typedef struct DeviceConfig
+{
+   // ms per cycle of an input and of an output op
+   int inCycleRate;
+   int outCycleRate;
+   
+   // channels of the device, zero is unlimited
+   int channelCount;
+} DeviceConfig;
+
+// MLFQ limits, and the level count used when no quanta are given
+typedef enum { MLFQ_MAX_LEVELS = 8,
+               MLFQ_DEFAULT_LEVELS = 3 } ConfigMlfqLimits;
 
 // config data structure
 typedef struct
@@ -44,6 +119,33 @@ typedef struct
    int ioCycleRate;
    int logToCode;
    char logToFileName[ 100 ];
+   double timeScale;
+   int ioTimerCode;
+   int cpuCoreCount;
+   int hostThreadCount;
+   int mlfqLevelCount;
+   int mlfqQuantumArray[ MLFQ_MAX_LEVELS ];
+   int mlfqBoostMS;
+   int cfsLatencyMS;
+   int cfsGranularityMS;
+   int deviceChannels;
+   int diskOrderCode;
+   int diskSeekRate;
+   DeviceConfig deviceTable[ DEVICE_COUNT ];
+   int contextSwitchMS;
+   int dispatchLatencyMS;
+   int interruptCostMS;
+   int memPlacementCode;
+   int pageSize;
+   int pageLevelCount;
+   int tlbEntryCount;
+   int tlbPolicyCode;
+   int tlbMissCycles;
+   int pageWalkCycles;
+   int residentFrameCount;
+   int pageReplaceCode;
+   int workingSetMS;
+   int thrashPercent;
 } ConfigDataType;
 
 // function prototypes
@@ -55,6 +157,16 @@ Boolean getConfigData(char *fileName,
 ConfigCpuDataCodes getCpuSchedCode( char *codeStr );
 int getDataLineCode( char *dataBuffer );
 ConfigLogDataCodes getLogToCode( char *logToStr );
+ConfigIoTimerCodes getIoTimerCode( char *ioTimerStr );
+ConfigDiskOrderCodes getDiskOrderCode( char *diskOrderStr );
+ConfigPlacementCodes getPlacementCode( char *placementStr );
+char *getPlacementName( int placementCode );
+ConfigTlbPolicyCodes getTlbPolicyCode( char *tlbPolicyStr );
+char *getTlbPolicyName( int tlbPolicyCode );
+ConfigPageReplaceCodes getPageReplaceCode( char *pageReplaceStr );
+char *getPageReplaceName( int pageReplaceCode );
+int getDeviceConfig( char *deviceStr, DeviceConfig *deviceConfig );
+int getMlfqQuanta( char *quantaStr, int *quantumArray );
 Boolean valueInRange( int lineCode, int intVal,
                                        double doubleVal, char *stringVal );
 
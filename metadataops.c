@@ -2,10 +2,14 @@
 #include <stdio.h>
 #include "metadataops.h"
 #include "StringUtils.h"
+#include "DeviceManagement.h"
 
 // global constants
 const int BAD_ARG_VAL = -1;
 
+// base of a mem allocate op that gives only its size
+const int MEM_PLACED_BASE = -1;
+
 
 /*
 Funtion name: addNode
@@ -35,6 +39,8 @@ OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode )
       copyString( localPtr->strArg1, newNode->strArg1 );
       localPtr->intArg2 = newNode->intArg2;
       localPtr->intArg3 = newNode->intArg3;
+      localPtr->intArg4 = newNode->intArg4;
+      localPtr->deviceId = newNode->deviceId;
       localPtr->opEndTime = newNode->opEndTime;
       
       localPtr->nextNode = NULL;
@@ -487,6 +493,8 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
    inData->inOutArg[ 0 ] = NULL_CHAR;
    inData->intArg2 = 0;
    inData->intArg3 = 0;
+   inData->intArg4 = 0;
+   inData->deviceId = -1;
    inData->opEndTime = 0.0;
    inData->nextNode = NULL;
    
@@ -528,6 +536,19 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
       // return argument error
       return CORRUPT_OPCMD_ARG_ERR;
    }   
+   // check for a dev op, resolve its device name to the device id
+      // function: compareString, findDeviceId
+   if( compareString( inData->command, "dev" ) == STR_EQ )
+   {
+      inData->deviceId = findDeviceId( inData->strArg1 );
+      
+      // check for a name that is not a device
+      if( inData->deviceId < 0 )
+      {
+         // return argument error
+         return CORRUPT_OPCMD_ARG_ERR;
+      }
+   }
    // check for last op command found
       // function: compareString
    if( compareString( inData->command, "sys" ) == STR_EQ
@@ -536,7 +557,7 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
       // return last op command found
       return LAST_OPCMD_FOUND_MSG;
    }   
-   // check for app start if seconds argument
+   // check for app start if arrival time argument
       // function: compareString
    if( compareString( inData->command, "app" ) == STR_EQ
          && compareString( inData->strArg1, "start" ) == STR_EQ )
@@ -554,6 +575,31 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
       }   
       // set first int argument to number
       inData->intArg2 = numBuffer;
+      
+      // check for the optional deadline after the arrival time
+      if( strBuffer[ runningStringIndex ] == COMMA )
+      {
+         // get number arg for deadline
+            // function: getNumberArg
+         runningStringIndex = getNumberArg( &numBuffer,
+                                          strBuffer, runningStringIndex );
+                                          
+         // check for failed number access
+         if( numBuffer <= BAD_ARG_VAL )
+         {
+            // set failure flag
+            arg3FailureFlag = True;
+         }
+         // set second int argument to number
+         inData->intArg3 = numBuffer;
+         
+         // check for a third number, app start takes none
+         if( strBuffer[ runningStringIndex ] == COMMA )
+         {
+            // set failure flag
+            arg3FailureFlag = True;
+         }
+      }
    }   
    // check for cpu cycle time
       // function: compareString
@@ -590,6 +636,24 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
       }  
       // set first int argument to number
       inData->intArg2 = numBuffer;
+      
+      // check for the optional disk track after the cycle time
+      if( strBuffer[ runningStringIndex ] == COMMA )
+      {
+         // get number arg for track
+            // function: getNumberArg
+         runningStringIndex = getNumberArg( &numBuffer,
+                                          strBuffer, runningStringIndex );
+                                          
+         // check for failed number access
+         if( numBuffer <= BAD_ARG_VAL )
+         {
+            // set failure flag
+            arg3FailureFlag = True;
+         }
+         // set second int argument to number
+         inData->intArg3 = numBuffer;
+      }
    }   
    // check for memory base and offset
       // function: compareString
@@ -609,19 +673,32 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
       // set first int argument to number
       inData->intArg2 = numBuffer;
       
-      // get number arg for offset
-         // function: getNumberArg
-      runningStringIndex = getNumberArg( &numBuffer,
+      // check for an allocation of a size alone, the MMU picks its base
+         // function: compareString
+      if( strBuffer[ runningStringIndex ] != COMMA
+            && compareString( inData->strArg1, "allocate" ) == STR_EQ )
+      {
+         // the base is left unset
+         inData->intArg2 = MEM_PLACED_BASE;
+         inData->intArg3 = numBuffer;
+      }
+      // otherwise, get the offset after the base
+      else
+      {
+         // get number arg for offset
+            // function: getNumberArg
+         runningStringIndex = getNumberArg( &numBuffer,
                                           strBuffer, runningStringIndex );
                                           
-      // check for failed number access
-      if( numBuffer <= BAD_ARG_VAL )
-      {         
-         // set failure flag
-         arg3FailureFlag = True;
-      }      
-      // set second int argument to number
-      inData->intArg3 = numBuffer;
+         // check for failed number access
+         if( numBuffer <= BAD_ARG_VAL )
+         {         
+            // set failure flag
+            arg3FailureFlag = True;
+         }      
+         // set second int argument to number
+         inData->intArg3 = numBuffer;
+      }
    }   
    // check int args for upload failure
    if( arg2FailureFlag == True || arg3FailureFlag == True )
@@ -19,6 +19,7 @@ typedef enum { MD_FILE_ACCESS_ERROR = 3,
 
 // create global constants - across files
 extern const int BAD_ARG_VAL;
+extern const int MEM_PLACED_BASE;
 
 // OpCodeType struct
 typedef struct OpCodeType
@@ -29,6 +30,10 @@ typedef struct OpCodeType
    char strArg1 [ 15 ];
    int intArg2;
    int intArg3;
+   int intArg4;
+   
+   // device id of a dev op, -1 for other ops
+   int deviceId;
 
    double opEndTime;
    struct OpCodeType *nextNode;
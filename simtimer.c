@@ -21,8 +21,13 @@
 #ifndef SIMTIMER_C
 #define SIMTIMER_C
 
+// clock_nanosleep and CLOCK_MONOTONIC are POSIX, not C99
+#define _POSIX_C_SOURCE 200112L
+
 // Header files ///////////////////////////////////////////////////////////////
 
+#include <time.h>
+#include <errno.h>
 #include "simtimer.h"
 #include "StringUtils.h"
 
@@ -30,74 +35,108 @@
 
 const char RADIX_POINT = '.';
 
-void runTimer( int milliSeconds )
+// Timer state  ///////////////////////////////////////////////////////////////
+
+/* All state lives in the SimTimer handed in by the caller.
+   In virtual time mode no wall clock time is spent; runTimer only
+   advances the simulated clock and accessTimer reports it.
+   In real time mode runTimer sleeps until an absolute deadline that is
+   advanced by each request, so time spent between requests is absorbed
+   instead of adding up; the time scale shrinks or stretches every request
+*/
+void initTimer( SimTimer *timer, int timerMode, double timeScale )
    {
-    struct timeval startTime, endTime;
-    int startSec, startUSec, endSec, endUSec;
-    int uSecDiff, mSecDiff, secDiff, timeDiff;
+    timer->timerMode = timerMode;
+    timer->timeScale = timeScale;
 
-    gettimeofday( &startTime, NULL );
- 
-    startSec = startTime.tv_sec;
-    startUSec = startTime.tv_usec;
+    timer->running = False;
+    timer->startSec = 0; timer->startUSec = 0;
+    timer->endSec = 0; timer->endUSec = 0;
+    timer->lapSec = 0; timer->lapUSec = 0;
 
-    timeDiff = 0;
+    timer->virtualUSec = 0;
+    timer->pacingNSec = 0;
+   }
 
-    while( timeDiff < milliSeconds )
-       {
-        gettimeofday( &endTime, NULL );
+void startPacing( SimTimer *timer )
+   {
+    struct timespec nowData;
 
-        endSec = endTime.tv_sec;
-        endUSec = endTime.tv_usec;
-        uSecDiff = endUSec - startUSec;
+    clock_gettime( CLOCK_MONOTONIC, &nowData );
 
-        if( uSecDiff < 0 )
-           {
-            uSecDiff = uSecDiff + 1000000;
+    timer->pacingNSec = (long long) nowData.tv_sec * 1000000000
+                                               + (long long) nowData.tv_nsec;
+   }
+
+void runTimer( SimTimer *timer, int milliSeconds )
+   {
+    struct timespec deadlineData;
 
-            endSec = endSec - 1;
+    if( timer->timerMode == VIRTUAL_TIME_MODE )
+       {
+        // jump straight to the end of the requested interval
+        if( milliSeconds > 0 )
+           {
+            timer->virtualUSec = timer->virtualUSec
+                                          + (long long) milliSeconds * 1000;
            }
 
-        mSecDiff = uSecDiff / 1000;
-        secDiff = ( endSec - startSec ) * 1000;
-        timeDiff = secDiff + mSecDiff;
+        return;
+       }
+
+    if( timer->pacingNSec == 0 )
+       {
+        startPacing( timer );
        }
+
+    timer->pacingNSec = timer->pacingNSec
+             + (long long) ( milliSeconds * timer->timeScale * 1000000.0 );
+
+    deadlineData.tv_sec = (time_t) ( timer->pacingNSec / 1000000000 );
+    deadlineData.tv_nsec = (long) ( timer->pacingNSec % 1000000000 );
+
+    while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME,
+                                           &deadlineData, NULL ) == EINTR );
    }
 
-double accessTimer( int controlCode, char *timeStr )
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr )
    {
-    static Boolean running = False;
-    static int startSec = 0, endSec = 0, startUSec = 0, endUSec = 0;
-    static int lapSec = 0, lapUSec = 0;
     struct timeval startData, lapData, endData;
     double fpTime = 0.0;
 
+    if( timer->timerMode == VIRTUAL_TIME_MODE )
+       {
+        return accessVirtualTimer( timer, controlCode, timeStr );
+       }
+
     switch( controlCode )
        {
         case ZERO_TIMER:
            gettimeofday( &startData, NULL );
-           running = True;
+           timer->running = True;
 
-           startSec = startData.tv_sec;
-           startUSec = startData.tv_usec;
+           timer->startSec = startData.tv_sec;
+           timer->startUSec = startData.tv_usec;
 
            fpTime = 0.000000000;
-           lapSec = 0.000000000;
-           lapUSec = 0.000000000;
+           timer->lapSec = 0.000000000;
+           timer->lapUSec = 0.000000000;
+
+           timeToString( timer->lapSec, timer->lapUSec, timeStr ); 
 
-           timeToString( lapSec, lapUSec, timeStr ); 
+           startPacing( timer );
            break;
            
         case LAP_TIMER:
-           if( running == True )
+           if( timer->running == True )
               {
                gettimeofday( &lapData, NULL );
 
-               lapSec = lapData.tv_sec;
-               lapUSec = lapData.tv_usec;
+               timer->lapSec = lapData.tv_sec;
+               timer->lapUSec = lapData.tv_usec;
 
-               fpTime = processTime( startSec, lapSec, 
-                                                 startUSec, lapUSec, timeStr );
+               fpTime = processScaledTime( timer, timer->startSec, 
+                  timer->lapSec, timer->startUSec, timer->lapUSec, timeStr );
               }
 
            else
@@ -107,16 +146,16 @@ double accessTimer( int controlCode, char *timeStr )
            break;
 
         case STOP_TIMER:
-           if( running == True )
+           if( timer->running == True )
               {
                gettimeofday( &endData, NULL );
-               running = False;
+               timer->running = False;
 
-               endSec = endData.tv_sec;
-               endUSec = endData.tv_usec;
+               timer->endSec = endData.tv_sec;
+               timer->endUSec = endData.tv_usec;
 
-               fpTime = processTime( startSec, endSec, 
-                                                 startUSec, endUSec, timeStr );
+               fpTime = processScaledTime( timer, timer->startSec, 
+                  timer->endSec, timer->startUSec, timer->endUSec, timeStr );
               }
 
            // assume timer not running
@@ -130,6 +169,58 @@ double accessTimer( int controlCode, char *timeStr )
     return fpTime;
    }
 
+double accessVirtualTimer( SimTimer *timer, int controlCode, char *timeStr )
+   {
+    int lapSec, lapUSec;
+    double fpTime = 0.000000000;
+
+    switch( controlCode )
+       {
+        case ZERO_TIMER:
+           timer->virtualUSec = 0;
+           timer->running = True;
+
+           timeToString( 0, 0, timeStr );
+           break;
+
+        case LAP_TIMER:
+        case STOP_TIMER:
+           if( timer->running == True )
+              {
+               lapSec = (int) ( timer->virtualUSec / 1000000 );
+               lapUSec = (int) ( timer->virtualUSec % 1000000 );
+
+               fpTime = processTime( 0, lapSec, 0, lapUSec, timeStr );
+              }
+
+           if( controlCode == STOP_TIMER )
+              {
+               timer->running = False;
+              }
+           break;
+       }
+
+    return fpTime;
+   }
+
+/* Wall clock time is reported in simulated time, so a run paced with
+   a time scale of 0.01 still shows the same timestamps as a normal run
+*/
+double processScaledTime( SimTimer *timer, double startSec, double endSec, 
+                           double startUSec, double endUSec, char *timeStr )
+   {
+    double elapsedUSec;
+    int scaledSec, scaledUSec;
+
+    elapsedUSec = ( ( endSec - startSec ) * 1000000.0
+                              + ( endUSec - startUSec ) ) / timer->timeScale;
+
+    scaledSec = (int) ( elapsedUSec / 1000000.0 );
+    scaledUSec = (int) ( elapsedUSec - scaledSec * 1000000.0 );
+
+    return processTime( 0, scaledSec, 0, scaledUSec, timeStr );
+   }
+
 double processTime( double startSec, double endSec, 
                            double startUSec, double endUSec, char *timeStr )
    {
@@ -29,13 +29,42 @@
 
 enum TIMER_CTRL_CODES { ZERO_TIMER, LAP_TIMER, STOP_TIMER };
 
+enum TIMER_MODE_CODES { REAL_TIME_MODE, VIRTUAL_TIME_MODE };
+
 extern const char RADIX_POINT;
 extern const char SPACE;
 
+// Data Types  ////////////////////////////////////////////////////////////////
+
+// all timer state for one simulation, so simulations can run side by side
+typedef struct SimTimer
+   {
+    // real time or virtual time
+    int timerMode;
+
+    // real time pacing speed factor
+    double timeScale;
+
+    // zero, lap and stop data
+    int running;
+    int startSec, startUSec, endSec, endUSec, lapSec, lapUSec;
+
+    // simulated clock used in virtual time
+    long long virtualUSec;
+
+    // absolute CLOCK_MONOTONIC deadline of the last paced request
+    long long pacingNSec;
+   } SimTimer;
+
 // Function Prototyp  /////////////////////////////////////////////////////////
 
-void runTimer( int milliSeconds );
-double accessTimer( int controlCode, char *timeStr );
+void initTimer( SimTimer *timer, int timerMode, double timeScale );
+void runTimer( SimTimer *timer, int milliSeconds );
+void startPacing( SimTimer *timer );
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr );
+double accessVirtualTimer( SimTimer *timer, int controlCode, char *timeStr );
+double processScaledTime( SimTimer *timer, double startSec, double endSec, 
+                           double startUSec, double endUSec, char *timeStr );
 double processTime( double startSec, double endSec, 
                            double startUSec, double endUSec, char *timeStr );
 void timeToString( int secTime, int uSecTime, char *timeStr );
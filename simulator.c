@@ -3,8 +3,14 @@
 #include "metadataops.h"
 #include "simtimer.h"
 #include "MemoryManagement.h"
+#include "PageManagement.h"
 #include "CpuManagement.h"
 #include "DisplayLog.h"
+#include "QueueManagement.h"
+#include "IoManagement.h"
+#include "SmpManagement.h"
+#include "SchedManagement.h"
+#include "DeviceManagement.h"
 #include <pthread.h>
 #include <signal.h>
 
@@ -31,11 +37,46 @@ PCB *addPcbNode( PCB *localPtr, PCB *newNode )
       // assign next pointer to null
          // function: copyString
       localPtr->pid = newNode->pid;
-      copyString( localPtr->processState, newNode->processState );
+      localPtr->processState = newNode->processState;
       localPtr->msLeft = newNode->msLeft;
       localPtr->thread = newNode->thread;
-      localPtr->waitTime = newNode->waitTime;
+      localPtr->dispatchStamp = newNode->dispatchStamp;
       localPtr->currentOpCode = newNode->currentOpCode;
+      localPtr->arrivalMSec = newNode->arrivalMSec;
+      localPtr->relDeadlineMS = newNode->relDeadlineMS;
+      localPtr->cpuDemandMS = newNode->cpuDemandMS;
+      
+      // not in any state queue yet
+      localPtr->ioDeadline = 0;
+      localPtr->nextFinish = NULL;
+      localPtr->finishPending = False;
+      localPtr->heapIndex = -1;
+      localPtr->nextEvent = NULL;
+      localPtr->prevEvent = NULL;
+      localPtr->wheelSlot = -1;
+      localPtr->coreId = -1;
+      localPtr->exitReached = False;
+      localPtr->mlfqLevel = 0;
+      localPtr->vruntime = 0;
+      localPtr->treeLeft = NULL;
+      localPtr->treeRight = NULL;
+      localPtr->treeParent = NULL;
+      localPtr->treeRedFlag = False;
+      localPtr->dueMSec = -1;
+      localPtr->firstRunMSec = -1;
+      localPtr->exitMSec = -1;
+      localPtr->deviceId = -1;
+      localPtr->ioTrack = 0;
+      localPtr->ioRequestMSec = 0;
+      localPtr->nextWaiting = NULL;
+      localPtr->placedBase = -1;
+      localPtr->pageTable = NULL;
+      localPtr->tlbHitCount = 0;
+      localPtr->tlbMissCount = 0;
+      localPtr->translationMS = 0;
+      localPtr->pageFaultCount = 0;
+      localPtr->swapPageCount = 0;
+      localPtr->ioPendingFlag = False;
       
       localPtr->nextNode = NULL;
          
@@ -52,22 +93,151 @@ PCB *addPcbNode( PCB *localPtr, PCB *newNode )
 }
 
 /*
-Funtion name: runIOThread
+Funtion name: initSimContext
+Algorithm: sets up all state owned by one simulation run
+Precondition: given context memory and uploaded config data
+Postcondiditon: context is ready to be handed to runSim
+Exceptions: none
+Note: the config data must outlive the context
+*/
+void initSimContext( SimContext *simContext, ConfigDataType *configPtr,
+                                                               int timerMode )
+{
+   // keep the config data and its logging option
+   simContext->configPtr = configPtr;
+   simContext->loggingFormatFlag = configPtr->logToCode;
+   
+   // allocate the (empty) head of the file output list
+      // function: malloc
+   simContext->logListHead = 
+                  (fileOutputBuffer *)malloc( sizeof( fileOutputBuffer ) );
+   simContext->logListHead->lineString[ 0 ] = NULL_CHAR;
+   simContext->logListHead->nextNode = NULL;
+   simContext->logListTail = simContext->logListHead;
+   
+   // no processes or memory yet
+   simContext->pcbListHead = NULL;
+   simContext->previousPid = -1;
+   
+      // function: initMemory
+   initMemory( simContext );
+   
+   // the cores are set up when a multi-core run starts
+   simContext->coreArray = NULL;
+   simContext->coreCount = configPtr->cpuCoreCount;
+   simContext->logCoreId = -1;
+   simContext->pdesWorker = NULL;
+   
+   // idle device servers
+      // function: initDevices
+   initDevices( simContext );
+   
+   // find the scheduler and set up its ready queue
+      // function: getScheduler, initQueue
+   simContext->schedOps = getScheduler( configPtr->cpuSchedCode );
+   simContext->schedOps->initQueue( &simContext->readyQueue,
+                                         simContext->schedOps->pcbBefore );
+   simContext->dispatchCounter = 0;
+   
+   // the first priority boost, for a scheduler that has one
+   simContext->nextBoostMSec = -1;
+   
+   if( simContext->schedOps->onBoost != NULL && configPtr->mlfqBoostMS > 0 )
+   {
+      simContext->nextBoostMSec = configPtr->mlfqBoostMS;
+   }
+   
+   // IO completions are ordered by deadline, in the heap or the wheel
+   simContext->simMSec = 0;
+   initHeap( &simContext->eventHeap, deadlinePcbBefore );
+   initWheel( &simContext->eventWheel );
+   
+   // empty state queues
+   simContext->runningPCB = NULL;
+   simContext->readyCount = 0;
+   simContext->blockedCount = 0;
+   simContext->exitCount = 0;
+   simContext->finishListHead = NULL;
+   
+   // display output unless a batch run says otherwise
+   simContext->quietFlag = False;
+   
+   // nothing run yet
+   simContext->processCount = 0;
+   simContext->segFaultCount = 0;
+   simContext->meanResponseMS = 0;
+   simContext->meanTurnaroundMS = 0;
+   simContext->endTime = 0.0;
+   
+   // no overhead charged yet
+   simContext->pendingOverheadMS = 0;
+   simContext->overheadMS = 0;
+   simContext->switchCount = 0;
+   simContext->interruptCount = 0;
+   simContext->overheadPercent = 0.0;
+   
+   // set up the timer
+      // function: initTimer
+   initTimer( &simContext->timer, timerMode, configPtr->timeScale );
+   
+   // no IO workers until a real time run starts them
+      // function: initIoPool
+   initIoPool( &simContext->ioPool );
+}
+
+/*
+Funtion name: clearSimContext
+Algorithm: stops and waits for the run's IO workers, then returns all
+           memory owned by the context to the OS
+Precondition: context was set up by initSimContext
+Postcondiditon: all context memory is freed, list heads are set to null
+Exceptions: none
+Note: none
+*/
+void clearSimContext( SimContext *simContext )
+{
+   // stop the IO workers and free their requests
+      // function: stopIoPool
+   stopIoPool( &simContext->ioPool );
+   
+   // clear all lists
+      // function: clearLogList, clearPCBList, clearMemoryBlocks
+   simContext->logListHead = clearLogList( simContext->logListHead );
+   simContext->logListTail = NULL;
+   simContext->pcbListHead = clearPCBList( simContext->pcbListHead );
+   clearMemoryBlocks( simContext );
+   
+   // release the ready and event queues
+      // function: clearQueue, clearHeap
+   simContext->schedOps->clearQueue( &simContext->readyQueue );
+   clearHeap( &simContext->eventHeap );
+   
+   // release the cores of a multi-core run
+      // function: clearSmpCores
+   clearSmpCores( simContext );
+   
+   // the state queues linked the freed PCBs
+   simContext->runningPCB = NULL;
+   simContext->finishListHead = NULL;
+}
+
+/*
+Funtion name: runThread
 Algorithm: Runs the timer for the number of cycles specified
            for the IO op code
-Precondition: Given op code pointer cycles
+Precondition: Given timer thread data with the op code time
 Postcondiditon: none
 Exceptions: none
 Note: none
 */
-void *runThread( void *milliseconds )
+void *runThread( void *threadData )
 {
-   // convert the void pointer into an int
-   int millisecondsToWait = *(int*) milliseconds;
+   // convert the void pointer into the thread data
+   TimerThreadData *timerData = (TimerThreadData *) threadData;
    
    // pause the program for the specified cycles
             // function: runTimer
-   runTimer( millisecondsToWait );
+   runTimer( timerData->timer, timerData->milliseconds );
    
    return NULL;
 }
@@ -82,49 +252,43 @@ Postcondiditon: simulation is provided, file output is provided as configured
 Exceptions: none
 Note: none
 */
-void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
+void runSim( SimContext *simContext, OpCodeType *metaDataMstrPtr )
 {  
    // initialize variables
+   ConfigDataType *configPtr = simContext->configPtr;
    int loggingFormatFlag;
-   int cpuSchedulingFlag;
-   int runMilliseconds;
+   TimerThreadData timerData;
    PCB *localPtr = NULL;
    PCB *pcbListHead = NULL;
    PCB *newNode = NULL;
    PCB *nodeSelector = NULL;
-   static PCB *previousProcess = NULL;
    OpCodeType *localMetaDataPtr = metaDataMstrPtr;
    int pidCounter = 0;
+   int opEndMSec;
    int queueCounter;
    fileOutputBuffer *localList = NULL;
-   static fileOutputBuffer *listHead = NULL;
    MemoryBlock *newMemNode = NULL;
-   static MemoryBlock *memListHead = NULL;
    FILE* logFile;
    cpuInterruptCodes currentInterrupt;
    Boolean allProcessesExited = False;
    Boolean allProcessesBlocked;
    Boolean segFault;
    DisplayCodes whichCommand;
-   pthread_t Thread;
+   char timeString[ STD_STR_LEN ];
    
    // reference the logging option in the config file (pointer) and apply it to a 
    //  string flag
-   loggingFormatFlag = configPtr->logToCode;
-      
-   // reference the cpu scheduling format and place it into another flag
-   cpuSchedulingFlag = configPtr->cpuSchedCode;
+   loggingFormatFlag = simContext->loggingFormatFlag;
    
    // allocate memory for the new node
       // function: malloc
    newNode = (PCB *)malloc( sizeof( PCB ) );
    
+   // start the first process with no time
+   newNode->msLeft = 0;
+   
    // allocate memory for the new memory block node
    newMemNode = (MemoryBlock *)malloc( sizeof( MemoryBlock ) );
-   
-   // allocate memory for the new file output block node
-   listHead = (fileOutputBuffer *)malloc( sizeof( fileOutputBuffer ) );
-   listHead->nextNode = NULL;
 
    // loop through op code list until local pointer is at sys end
    while( localMetaDataPtr->nextNode != NULL )
@@ -138,8 +302,7 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
          if( compareString(localMetaDataPtr->strArg1, "start" ) == STR_EQ )
          {            
             // state for PCB will be set to NEW
-               // function: copyString
-            copyString( newNode->processState, "NEW" );
+            newNode->processState = PCB_NEW_STATE;
             
             // set current pid counter to PCB pid
             newNode->pid = pidCounter;
@@ -149,8 +312,13 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
             
             newNode->currentOpCode = localMetaDataPtr;
             
-            // set wait tiime to zero
-            newNode->waitTime = 0;
+            // not selected yet
+            newNode->dispatchStamp = 0;
+            
+            // keep the arrival and deadline, no cpu time counted yet
+            newNode->arrivalMSec = localMetaDataPtr->intArg2;
+            newNode->relDeadlineMS = localMetaDataPtr->intArg3;
+            newNode->cpuDemandMS = 0;
          }
          // check for end arg in current line
             // function: compareString
@@ -178,13 +346,17 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
       {
          // increment the PCB node's time left by calculating the cycles x ms/cycle
          newNode->msLeft += localMetaDataPtr->intArg2 * configPtr->procCycleRate;
+         newNode->cpuDemandMS += localMetaDataPtr->intArg2 
+                                                   * configPtr->procCycleRate;
       }
       // check for if the command is an IO bound process
          // function: compareString
       if( compareString( localMetaDataPtr->command, "dev" ) == STR_EQ )
       {
-         // increment the PCB node's time left by calculating the cycles x ms/cycle
-         newNode->msLeft += localMetaDataPtr->intArg2 * configPtr->ioCycleRate;
+         // increment the PCB node's time left by calculating the cycles x
+         //    ms/cycle of the op's device
+            // function: getDeviceOpMS
+         newNode->msLeft += getDeviceOpMS( configPtr, localMetaDataPtr );
       }
       
       // iterate to next op code
@@ -192,6 +364,9 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
    }
    // end loop
    
+   // hand the PCB list to the context
+   simContext->pcbListHead = pcbListHead;
+   
    // set node pointer to beginning of PCB list
    localPtr = pcbListHead;
    
@@ -199,26 +374,48 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
    queueCounter = pidCounter;
    
    // initialize logging process
-   displayAndLog( loggingFormatFlag, NULL, listHead, INIT, NONE );
+   displayAndLog( simContext, NULL, INIT, NONE );
    
    // loop through PCB linked list to set all in ready state
    while( localPtr != NULL )
    {    
-      // change state within PCB to READY
-         // copyString
-      copyString( localPtr->processState, "READY" );
-      
-      // set the op code MS left
-      localPtr->opMSLeft = 0;
+      // set default wait time for the PCB, lower pids have waited longer
+      localPtr->dispatchStamp = -queueCounter;
       
-      // set default wait time for the PCB
-      localPtr->waitTime = queueCounter;
+      // set the absolute deadline from the arrival
+      if( localPtr->relDeadlineMS > 0 )
+      {
+         localPtr->dueMSec = localPtr->arrivalMSec + localPtr->relDeadlineMS;
+      }
       
-      // log event
-      displayAndLog( loggingFormatFlag, localPtr, listHead, PCB_NEW, PCB_READY );
+      // check for a process that arrives later
+      if( localPtr->arrivalMSec > 0 )
+      {
+         // it waits in NEW on the event queue until it arrives
+            // function: addEventNode
+         localPtr->ioDeadline = localPtr->arrivalMSec;
+         addEventNode( simContext, localPtr );
+      }
+      // otherwise, it is ready at the start
+      else
+      {
+         // change state within PCB to READY
+            // function: setPcbState
+         setPcbState( simContext, localPtr, PCB_READY_STATE );
+         
+         // set the op code MS left
+         localPtr->opMSLeft = 0;
+         
+         // log event
+         displayAndLog( simContext, localPtr, PCB_NEW, PCB_READY );
 
-      // set up PCB for running
-      updatePcbOpCode( localPtr, configPtr );
+         // set up PCB for running
+         updatePcbOpCode( localPtr, configPtr );
+         
+         // an empty program is already at app end
+            // function: queueFinishedPcb
+         queueFinishedPcb( simContext, localPtr );
+      }
       
       // decrement the queue counter by 1
       queueCounter--;
@@ -228,8 +425,19 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
    }
    // end loop
    
+   // keep the number of processes for the run summary
+   simContext->processCount = pidCounter;
+   
+   // check for real time, virtual time needs no IO workers
+   if( simContext->timer.timerMode == REAL_TIME_MODE )
+   {
+      // start the IO workers
+         // function: startIoPool
+      startIoPool( &simContext->ioPool, pidCounter );
+   }
+   
    // check if the log spec is to file
-   if( loggingFormatFlag == LOGTO_FILE_CODE )
+   if( loggingFormatFlag == LOGTO_FILE_CODE && simContext->quietFlag == False )
    {
       printf("Completeing logging process, please wait...\n");
    }
@@ -237,261 +445,367 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
    // set node pointer back to head of PCB linked list
    localPtr = pcbListHead;
    
-   // set the new node's pid to mark previous processes
-   newNode->pid = -1;
-   
-   // set the first previous process pointer
-   previousProcess = newNode;
+   // mark that no process has been selected yet
+   simContext->previousPid = -1;
 ////////////////////////////////////////////////////////////////////////////////
 
-   // create a case for each sched flag
-   switch( cpuSchedulingFlag )
+   // check for more than one core, the multi-core engine runs every
+   //    scheduling code
+   if( simContext->coreCount > 1 )
    {
-      case CPU_SCHED_SJF_N_CODE:
-      case CPU_SCHED_FCFS_N_CODE:
-         
-         // loop untl a node selector has not found a suitable pcb
-         do
-            {
-               // assume there is no seg fault
-               segFault = False;
+      // function: runSmpSim
+      runSmpSim( simContext );
+   }
+   // otherwise, run the single core loops
+   else
+   {
+      // check if the scheduler runs each process to its end
+      if( simContext->schedOps->preemptiveFlag == False )
+      {
+            // loop untl a node selector has not found a suitable pcb
+            do
+               {
+                  // assume there is no seg fault
+                  segFault = False;
+                  
+                  // with nothing ready, idle until the next arrival
+                     // function: peekEventNode
+                  if( simContext->readyCount == 0
+                                       && peekEventNode( simContext ) != NULL )
+                  {
+                     // function: cpuIdle, admitArrivals
+                     cpuIdle( simContext );
+                     admitArrivals( simContext );
+                  }
                
-               // get a node
-                  // function: nodeSelector
-               nodeSelector = selectPCB( pcbListHead, cpuSchedulingFlag,
-                                         loggingFormatFlag,
-                                         listHead, configPtr,
-                                         previousProcess );
+                  // get a node
+                     // function: nodeSelector
+                  nodeSelector = selectPCB( simContext );
             
-            // only do this branch if node found
-            if( nodeSelector != NULL )
-            {
-               // while the current op code is not on an app end (and no seg fault)
-               while( compareString( nodeSelector->currentOpCode->strArg1, 
-                                                            "end") != STR_EQ &&
-                                                segFault == False )
+               // only do this branch if node found
+               if( nodeSelector != NULL )
                {
-                  // check if its a mem op
-                  if( compareString( nodeSelector->currentOpCode->command, 
-                                                            "mem") == STR_EQ )
+                  // while the current op code is not on an app end (and no seg fault)
+                  while( compareString( nodeSelector->currentOpCode->strArg1, 
+                                                               "end") != STR_EQ &&
+                                                   segFault == False )
                   {
-                     // check if its an allocation
-                     if( compareString( nodeSelector->currentOpCode->strArg1, 
-                                                               "allocate") == STR_EQ )
+                     // check if its a mem op
+                     if( compareString( nodeSelector->currentOpCode->command, 
+                                                               "mem") == STR_EQ )
                      {
-                        // create new mem node
+                        // create new mem node, an access uses the same range
                         newMemNode->lowerBound = nodeSelector->currentOpCode->intArg2;
                         newMemNode->upperBound = ( nodeSelector->currentOpCode->
                                      intArg3 + nodeSelector->currentOpCode->intArg2 );
                         newMemNode->designatedPCB = nodeSelector;
                         
-                        // if so, allocate mem and set to boolean
-                           // function: allocateMem
-                        segFault = allocateMem( newMemNode, &memListHead, configPtr );
-                     }
-                     // otherwise, assume its an access
-                     else
-                     {
-                        // access mem and set to boolean
-                           // function: accessMem
-                        segFault = accessMem( newMemNode->lowerBound, 
-                           newMemNode->upperBound, memListHead, 
-                           configPtr, nodeSelector->pid );
-                     }
-                     
-                     // log event
-                     displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                      listHead, MEM_START, NONE );
+                        // check if its an allocation
+                        if( compareString( nodeSelector->currentOpCode->strArg1, 
+                                                                  "allocate") == STR_EQ )
+                        {
+                           // if so, allocate mem and set to boolean
+                              // function: allocateMem
+                           segFault = allocateMem( simContext, newMemNode );
+                        }
+                        // otherwise, assume its an access
+                        else
+                        {
+                           // access mem and set to boolean
+                              // function: accessMem
+                           segFault = accessMem( simContext, 
+                              newMemNode->lowerBound, newMemNode->upperBound,
+                              nodeSelector->pid );
+                           
+                           // check for a paged access, the cpu owes the
+                           //    translation
+                              // function: translateAccess
+                           if( segFault == False && configPtr->pageSize > 0 )
+                           {
+                              simContext->pendingOverheadMS =
+                                 simContext->pendingOverheadMS
+                                 + translateAccess( simContext,
+                                    &simContext->tlb, nodeSelector,
+                                    newMemNode->lowerBound,
+                                    newMemNode->upperBound,
+                                    simContext->simMSec );
+                           }
+                        }
                      
-                     // check if seg fault occured
-                     if( segFault == True )
-                     {
                         // log event
-                        displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                         listHead, MEM_FAIL, NONE );
+                        displayAndLog( simContext, nodeSelector, MEM_START, NONE );
+                     
+                        // check if seg fault occured
+                        if( segFault == True )
+                        {
+                           // count the seg fault
+                           simContext->segFaultCount++;
+                        
+                           // log event
+                           displayAndLog( simContext, nodeSelector, MEM_FAIL, NONE );
+                        }
+                        // otherise, report successful
+                        else
+                        {
+                           // check for a page fault, wait out the swap in
+                           if( nodeSelector->swapPageCount > 0 )
+                           {
+                              // function: startPageFault
+                              startPageFault( simContext, nodeSelector );
+                              
+                              // function: submitIoRequest
+                              submitIoRequest( &simContext->ioPool,
+                                       &simContext->timer, nodeSelector );
+                              
+                              // admit the processes arriving during the
+                              //    swap in at their arrival times
+                                 // function: admitArrivalsBefore
+                              opEndMSec = simContext->simMSec
+                                                   + nodeSelector->opMSLeft;
+                              admitArrivalsBefore( simContext, opEndMSec );
+                              
+                              // set up time for thread use
+                              timerData.timer = &simContext->timer;
+                              timerData.milliseconds = opEndMSec
+                                                   - simContext->simMSec;
+                              
+                              // function: awaitIoCompletion, runThread
+                              awaitIoCompletion( &simContext->ioPool,
+                                                            nodeSelector );
+                              runThread( (void*)&timerData );
+                              
+                              simContext->simMSec = opEndMSec;
+                           }
+                           
+                           // log event
+                           displayAndLog( simContext, nodeSelector, MEM_SUCCESS, NONE );
+                           
+                           // check for paged memory, the cpu stalls for
+                           //    the translation owed
+                              // function: runOverhead
+                           if( configPtr->pageSize > 0 )
+                           {
+                              runOverhead( simContext );
+                           }
+                        }
                      }
-                     // otherise, report successful
+                     // otherwise, assume dev or cpu
                      else
                      {
+                        // find appropriate display code
+                        whichCommand = findDisplayCode( 
+                                             nodeSelector->currentOpCode->command );
                         // log event
-                        displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                         listHead, MEM_SUCCESS, NONE );
-                     }
-                  }
-                  // otherwise, assume dev or cpu
-                  else
-                  {
-                     // find appropriate display code
-                     whichCommand = findDisplayCode( 
-                                          nodeSelector->currentOpCode->command );
-                     // log event
-                     displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                      listHead, whichCommand, START );
+                        displayAndLog( simContext, nodeSelector, whichCommand, START );
                      
-                     // set up time for thread use
-                     runMilliseconds = nodeSelector->opMSLeft;
+                        // hand the op to an IO worker ( real time only )
+                           // function: submitIoRequest
+                        submitIoRequest( &simContext->ioPool, &simContext->timer,
+                                                                nodeSelector );
                      
-                     // run IO Thread
-                        // function: pthread_create, pthread_join
-                     pthread_create( &Thread, NULL, runThread, (void*)&runMilliseconds );
-                     pthread_join( Thread, NULL );
+                        // admit the processes arriving during the op at
+                        //    their arrival times
+                           // function: admitArrivalsBefore
+                        opEndMSec = simContext->simMSec + nodeSelector->opMSLeft;
+                        admitArrivalsBefore( simContext, opEndMSec );
                      
-                     // log event
-                     displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                      listHead, whichCommand, FINISH );
+                        // set up time for thread use
+                        timerData.timer = &simContext->timer;
+                        timerData.milliseconds = opEndMSec - simContext->simMSec;
+                     
+                        // wait for the IO worker to finish the op, the
+                        //    scheduler has nothing else to run; the timer
+                        //    then catches up to the op's end
+                           // function: awaitIoCompletion, runThread
+                        awaitIoCompletion( &simContext->ioPool, nodeSelector );
+                        runThread( (void*)&timerData );
+                        
+                        // charge the op to the simulated time
+                        simContext->simMSec = opEndMSec;
+                     
+                        // log event
+                        displayAndLog( simContext, nodeSelector, whichCommand, FINISH );
+                     }
+                     // update the op code for specific pcb
+                     updatePcbOpCode( nodeSelector, configPtr );
+                     
+                     // admit the processes that arrived during the op
+                        // function: admitArrivals
+                     admitArrivals( simContext );
                   }
-                  // update the op code for specific pcb
-                  updatePcbOpCode( nodeSelector, configPtr );
+                  // log exit event
+                  displayAndLog( simContext, nodeSelector, PCB_EXIT, NONE );
+                  // set pcb to exit
+                     // function: setPcbState
+                  setPcbState( simContext, nodeSelector, PCB_EXIT_STATE );
                }
-               // log exit event
-               displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                listHead, PCB_EXIT, NONE );
-               // set pcb to exit
-               copyString( nodeSelector->processState, "EXIT" );
-            }
-            } while( nodeSelector != NULL );
-         
-         break;
-
-      // check if CPU scheduling flag is preemptive
-      case CPU_SCHED_FCFS_P_CODE:
-      case CPU_SCHED_SRTF_P_CODE:
-      case CPU_SCHED_RR_P_CODE:
-
-         // loop until all processes are in exit state
-         while( allProcessesExited == False )
-         {
-            // set boolean saying all PCB's in exit state to true
-            allProcessesExited = True;
-            
-            // set boolean saying all PCB's are in blocked state
-            allProcessesBlocked = True;
-            
-            // set local pointer to list head
-            localPtr = pcbListHead;
-            
-            // loop through list of PCB's 
-            while( localPtr != NULL )
+               } while( nodeSelector != NULL );
+      }
+      // otherwise, the scheduler is preemptive
+      else
+      {
+            // loop until all processes are in exit state
+            while( allProcessesExited == False )
             {
-               //printf( "PCB %d State: %s Total ms left: %d \n", localPtr->pid, localPtr->processState, localPtr->msLeft );
-               // check if they are not in exit state
-                // function: compareString
-               if( compareString( localPtr->processState, "EXIT" ) != STR_EQ )
+               // set boolean saying all PCB's in exit state from the counters
+               allProcessesExited = False;
+            
+               if( simContext->exitCount == simContext->processCount )
                {
-                  // if so, switch the exit state flag to false
-                  allProcessesExited = False;
+                  allProcessesExited = True;
                }
-               // check if PCB is not in blocked state or exit state
-               if( compareString( localPtr->processState,
-                                                      "READY" ) == STR_EQ )
+            
+               // set boolean saying no PCB is ready to run
+               allProcessesBlocked = False;
+            
+               if( simContext->readyCount == 0 )
                {
-                  // if so, switch the designated flag to false
-                  allProcessesBlocked = False;
+                  allProcessesBlocked = True;
                }
-               
-               // iterate to next node
-               localPtr = localPtr->nextNode;
-            }
-            // end loop
             
-            // set the focus PCB with respective scheduler
-               // function: selectPCB
-            nodeSelector = selectPCB( pcbListHead, cpuSchedulingFlag, 
-                                      loggingFormatFlag, listHead, configPtr, 
-                                      previousProcess );
+               // set the focus PCB with respective scheduler
+                  // function: selectPCB
+               nodeSelector = selectPCB( simContext );
 
-            // check if all processes have been exited
-            if( allProcessesExited == True )
-            {
-               // log event
-               displayAndLog( loggingFormatFlag, localPtr, listHead, ALL_EXIT, NONE );
-
-               // set interrupt code to null
-               currentInterrupt = NO_INTERRUPT;
-            }
-            // check if all blocked flag
-            else if( allProcessesBlocked == True )
-            {
-               // if so, run the cpu idle case and set its interrupt code
-                  // function: cpuIdle
-               currentInterrupt = cpuIdle( pcbListHead, loggingFormatFlag,
-                                                         listHead, configPtr );
-            }
-            // check if current op code is cpu
-            else if( compareString( nodeSelector->currentOpCode->command, 
-                                                            "mem" ) != STR_EQ )
-            {
-               // run cpu until cycles are gone or quantum out and set
-               //   interrupt code
-               // function: cpuRun
-               currentInterrupt = cpuRun( pcbListHead, nodeSelector,
-                                 loggingFormatFlag, listHead, configPtr );
-            }
-            // otherwise, op is mem
-            else
-            {
-               // create new mem node
-               newMemNode->lowerBound = nodeSelector->currentOpCode->intArg2;
-               newMemNode->upperBound = ( nodeSelector->currentOpCode->
-                            intArg3 + nodeSelector->currentOpCode->intArg2 );
-               newMemNode->designatedPCB = nodeSelector;
-               
-               // check if it specifies allocation
-               if( compareString( nodeSelector->currentOpCode->strArg1, 
-                                                        "allocate" ) == STR_EQ )
+               // check if all processes have been exited
+               if( allProcessesExited == True )
                {
                   // log event
-                  displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                   listHead, MEM_START, NONE );
-               
-                  // if so, allocate mem and set to boolean
-                     // function: allocateMem
-                  segFault = allocateMem( newMemNode, &memListHead, configPtr );
-                     
+                  displayAndLog( simContext, NULL, ALL_EXIT, NONE );
+
+                  // set interrupt code to null
+                  currentInterrupt = NO_INTERRUPT;
                }
-               // otherwise, it is an access request
-               else
+               // check if all blocked flag
+               else if( allProcessesBlocked == True )
                {
-                  // log event
-                  displayAndLog( loggingFormatFlag, nodeSelector, 
-                                                   listHead, MEM_START, NONE );
-               
-                  // access mem and set to boolean
-                     // function: accessMem
-                  segFault = accessMem( newMemNode->lowerBound, 
-                     newMemNode->upperBound, memListHead, 
-                     configPtr, nodeSelector->pid );
+                  // if so, run the cpu idle case and set its interrupt code
+                     // function: cpuIdle
+                  currentInterrupt = cpuIdle( simContext );
                }
-               
-               // check if seg fault occured
-               if( segFault == True )
+               // check if current op code is cpu
+               else if( compareString( nodeSelector->currentOpCode->command, 
+                                                               "mem" ) != STR_EQ )
                {
-                  // if yes, set interrupt code to seg fault
-                  currentInterrupt = INTERRUPT_SEG_FAULT;
+                  // run cpu until cycles are gone or quantum out and set
+                  //   interrupt code
+                  // function: cpuRun
+                  currentInterrupt = cpuRun( simContext, nodeSelector );
                }
-               // otherise, report successful
+               // otherwise, op is mem
                else
                {
-                  currentInterrupt = SUCCESSFUL_MEM_OP;
+                  // create new mem node
+                  newMemNode->lowerBound = nodeSelector->currentOpCode->intArg2;
+                  newMemNode->upperBound = ( nodeSelector->currentOpCode->
+                               intArg3 + nodeSelector->currentOpCode->intArg2 );
+                  newMemNode->designatedPCB = nodeSelector;
+               
+                  // check if it specifies allocation
+                  if( compareString( nodeSelector->currentOpCode->strArg1, 
+                                                           "allocate" ) == STR_EQ )
+                  {
+                     // log event
+                     displayAndLog( simContext, nodeSelector, MEM_START, NONE );
+               
+                     // if so, allocate mem and set to boolean
+                        // function: allocateMem
+                     segFault = allocateMem( simContext, newMemNode );
+                     
+                  }
+                  // otherwise, it is an access request
+                  else
+                  {
+                     // log event
+                     displayAndLog( simContext, nodeSelector, MEM_START, NONE );
+               
+                     // access mem and set to boolean
+                        // function: accessMem
+                     segFault = accessMem( simContext, 
+                        newMemNode->lowerBound, newMemNode->upperBound,
+                        nodeSelector->pid );
+                     
+                     // check for a paged access, the cpu owes the
+                     //    translation and pays it at the next selection
+                        // function: translateAccess
+                     if( segFault == False && configPtr->pageSize > 0 )
+                     {
+                        simContext->pendingOverheadMS =
+                           simContext->pendingOverheadMS
+                           + translateAccess( simContext, &simContext->tlb,
+                              nodeSelector, newMemNode->lowerBound,
+                              newMemNode->upperBound, simContext->simMSec );
+                     }
+                  }
+               
+                  // check if seg fault occured
+                  if( segFault == True )
+                  {
+                     // if yes, set interrupt code to seg fault
+                     currentInterrupt = INTERRUPT_SEG_FAULT;
+                  }
+                  // otherwise, check for a page fault, the process blocks
+                  //    for the swap device
+                  else if( nodeSelector->swapPageCount > 0 )
+                  {
+                     // function: startPageFault, submitIoRequest
+                     startPageFault( simContext, nodeSelector );
+                     submitIoRequest( &simContext->ioPool, &simContext->timer,
+                                                             nodeSelector );
+                     
+                     currentInterrupt = INTERRUPT_FROM_IO_BLOCK;
+                  }
+                  // otherise, report successful
+                  else
+                  {
+                     currentInterrupt = SUCCESSFUL_MEM_OP;
+                  }
                }
+               // handle the interrupt case
+                  // function: interruptHandler
+               interruptHandler( simContext, currentInterrupt, nodeSelector );
             }
-            // handle the interrupt case
-               // function: interruptHandler
-            interruptHandler( pcbListHead, currentInterrupt,loggingFormatFlag, 
-                              listHead, configPtr, nodeSelector );
-         }
-         // end loop
-         break;
+            // end loop
+      }
    }
    
 ////////////////////////////////////////////////////////////////////////////////
    
+   // show the deadline results, if any process has a deadline
+      // function: reportDeadlines
+   reportDeadlines( simContext );
+   
+   // show the response and turnaround times, if processes arrive later
+      // function: reportProcessTimes
+   reportProcessTimes( simContext );
+   
+   // show the load on each device, if the device channels are limited
+      // function: reportDevices
+   reportDevices( simContext );
+   
+   // show the context switch and interrupt overhead, if it has a cost
+      // function: reportOverhead
+   reportOverhead( simContext );
+   
+   // show the memory placement, if any allocation gave only its size
+      // function: reportPlacement
+   reportPlacement( simContext );
+   
+   // show the TLB hits and translation time, if memory is paged
+      // function: reportPaging
+   reportPaging( simContext );
+   
+   // record the simulated end time for the run summary
+      // function: accessTimer
+   simContext->endTime = accessTimer( &simContext->timer, LAP_TIMER, 
+                                                                 timeString );
+   
    // check if the logging option is file log or both
    if( loggingFormatFlag == LOGTO_FILE_CODE
        || loggingFormatFlag == LOGTO_BOTH_CODE )
    {     
       // put output list pointer back to the head
-      localList = listHead;
+      localList = simContext->logListHead;
    
       // open blank log file
          // function: fopen
@@ -513,21 +827,18 @@ void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr )
       fclose( logFile );
    }
    
-   listHead = clearLogList( listHead );
-   
-   pcbListHead = clearPCBList( pcbListHead );
-   
-   memListHead = clearMemoryList( memListHead );
-   
-   // free allocated memory for PCB and output list
+   // free allocated memory for the new PCB and memory nodes
       // function: free
    free( newNode );
    free( newMemNode );
       
    // end program (and display so)
       // function: printf
-   printf("-----------------\n\n");
-   printf("Simulator End\n");
+   if( simContext->quietFlag == False )
+   {
+      printf("-----------------\n\n");
+      printf("Simulator End\n");
+   }
       
 }
 
@@ -630,5 +941,8 @@ void showProgramFormat()
    printf( "      -dc [optional] displays configuration data\n" );
    printf( "      -dm [optional] displays meta data\n" );
    printf( "      -rs [optional] runs simulator\n" );
+   printf( "      -vt [optional] runs simulator in virtual time\n" );
+   printf( "      -batch manifest [-j N] [optional] runs each config in the\n" );
+   printf( "             manifest on N worker threads, prints a summary\n" );
    printf( "      config file name is required to run\n" );
 }
@@ -5,11 +5,13 @@
 // header files
 #include <stdio.h> // file operations
 #include <stdlib.h> // dynamic memory operations
+#include <pthread.h> // IO worker pool
 #include "metadataops.h"
 #include "configops.h"
 #include "MemoryManagement.h"
 #include "simulator.h"
 #include "DisplayLog.h"
+#include "simtimer.h"
 
 // create global constants - across files
 extern const int MAX_MILLISECONDS;
@@ -20,13 +22,14 @@ extern char *SchedTypes[];
 typedef enum { PCB_NEW_STATE,
                PCB_READY_STATE,
                PCB_RUNNING_STATE,
+               PCB_BLOCKED_STATE,
                PCB_EXIT_STATE } pcbStateCodes;
                
 // PCB data structure
 typedef struct PCB
 {
    // This specifies the process state i.e. new, ready, running, waiting or terminated.
-   char processState [ 15 ];
+   pcbStateCodes processState;
    
    // This shows the number of the particular process.
    int pid;
@@ -37,8 +40,9 @@ typedef struct PCB
    // time left for current op code
    int opMSLeft;
    
-   // wait time for pcb
-   int waitTime;
+   // dispatch count when last selected, pid minus process count before
+   //    its first selection ( the lowest stamp has waited longest )
+   int dispatchStamp;
    
    // op code location
    OpCodeType *currentOpCode;
@@ -46,21 +50,574 @@ typedef struct PCB
    // pointer to the next PCB process
    struct PCB *nextNode;
    
+   // simulated time its current IO op completes, while blocked
+   int ioDeadline;
+   
+   // link in the list of PCBs waiting to be set to EXIT
+   struct PCB *nextFinish;
+   Boolean finishPending;
+   
+   // position in the heap holding the PCB, -1 if none
+   int heapIndex;
+   
+   // links and slot in the timing wheel holding the PCB, slot -1 if none
+   struct PCB *nextEvent;
+   struct PCB *prevEvent;
+   int wheelSlot;
+   
+   // core whose run queue holds the PCB ( multi-core runs )
+   int coreId;
+   
+   // set once the PCB enters EXIT; read instead of the state, which a
+   //    parallel run changes from other threads
+   Boolean exitReached;
+   
+   // MLFQ level, zero is the top
+   int mlfqLevel;
+   
+   // CFS virtual runtime in ms, and the red-black tree links
+   int vruntime;
+   struct PCB *treeLeft;
+   struct PCB *treeRight;
+   struct PCB *treeParent;
+   Boolean treeRedFlag;
+   
+   // arrival time from app start, the simulated times the process first
+   //    ran and reached EXIT ( -1 until then )
+   int arrivalMSec;
+   int firstRunMSec;
+   int exitMSec;
+   
+   // relative deadline from app start in ms ( 0 for none ), the absolute
+   //    deadline ( -1 for none ) and cpu ms of the program
+   int relDeadlineMS;
+   int dueMSec;
+   int cpuDemandMS;
+   
+   // device of the current IO op ( -1 for none ), its disk track, the time
+   //    it was asked for and the link in the device wait list
+   int deviceId;
+   int ioTrack;
+   int ioRequestMSec;
+   struct PCB *nextWaiting;
+   
+   // base of the block the MMU last placed for the process
+   int placedBase;
+   
+   // page table root ( null until the first page is mapped ), and the
+   //    TLB lookups and translation time of its accesses
+   struct PageNode *pageTable;
+   int tlbHitCount;
+   int tlbMissCount;
+   int translationMS;
+   double tlbHitPercent;
+   
+   // pages its faults loaded from swap and their share of its page
+   //    references, and the pages of the current access waiting for the
+   //    swap device ( 0 for none )
+   int pageFaultCount;
+   double faultPercent;
+   int swapPageCount;
+   
+   // an IO worker holds a request for its current op ( real time only )
+   Boolean ioPendingFlag;
+   
    // thread to linked list
    struct OpCodeType *thread;
 } PCB;
 
+// ordering of a PCB heap or tree, True if the first PCB comes first
+typedef Boolean (*PcbBefore)( PCB *onePCB, PCB *otherPCB );
+
+// binary min heap of PCBs, ordered by its comparator
+typedef struct PcbHeap
+{
+   // PCB pointers, each PCB keeps its own index
+   PCB **heapArray;
+   int heapSize;
+   int heapCapacity;
+   
+   // ordering of the heap
+   PcbBefore nodeBefore;
+} PcbHeap;
+
+// circular FIFO queue of PCBs
+typedef struct PcbRing
+{
+   // PCB pointers, oldest at the head index
+   PCB **ringArray;
+   int ringHead;
+   int ringSize;
+   int ringCapacity;
+} PcbRing;
+
+// red-black tree of PCBs ordered by its comparator, caching the leftmost
+typedef struct PcbTree
+{
+   PCB *treeRoot;
+   PCB *leftmostNode;
+   int treeSize;
+   
+   // ordering of the tree
+   PcbBefore nodeBefore;
+} PcbTree;
+
+// ready queue of one context or core; the scheduler allocates the queue
+//    state it needs when the queue is set up and frees it when cleared
+typedef struct ReadyQueue
+{
+   void *queueState;
+} ReadyQueue;
+
+// deadline results of a run, filled in after every process exits
+typedef struct DeadlineReport
+{
+   // processes with a deadline, and those that exited after it
+   int deadlineCount;
+   int missCount;
+   
+   // exit time minus deadline in ms, negative when early
+   int latenessMin;
+   int latenessMedian;
+   int latenessHigh;
+   int latenessMax;
+   
+   // sum of cpu ms over deadline of the processes, in percent, and
+   //    whether it passes the EDF density test for the core count
+   int loadPercent;
+   Boolean schedulableFlag;
+} DeadlineReport;
+
+// one device server, with its channels and the processes waiting for one
+typedef struct SimDevice
+{
+   // channels of the device and those serving a request
+   int channelCount;
+   int busyChannels;
+   
+   // PCBs waiting for a channel, oldest request first
+   struct PCB *waitHead;
+   struct PCB *waitTail;
+   int waitCount;
+   
+   // track under the disk head and the SCAN sweep direction
+   int headTrack;
+   Boolean headUpFlag;
+   
+   // run summary; busy time is in channel ms, the depth sum is the wait
+   //    count integrated over time up to the last change
+   int requestCount;
+   int busyMS;
+   long long waitSumMS;
+   int waitMaxMS;
+   long long depthSumMS;
+   int depthMax;
+   int lastChangeMSec;
+   
+   // busy percent of the channels, mean wait and mean queue depth, set
+   //    at the end of the run
+   int busyPercent;
+   int meanWaitMS;
+   double meanDepth;
+} SimDevice;
+
+// one TLB entry, a page of a process and the frame it maps to
+typedef struct TlbEntry
+{
+   int pid;
+   int pageNumber;
+   int frameNumber;
+   
+   // lookup count when last used, the LRU entry has the lowest
+   long long useStamp;
+} TlbEntry;
+
+// translation lookaside buffer of one cpu; entries are tagged with the
+//    pid, so a switch does not flush it
+typedef struct Tlb
+{
+   TlbEntry *entryArray;
+   int entryCount;
+   int entryCapacity;
+   
+   // lookups so far, and the state of the random replacement generator
+   long long lookupCounter;
+   unsigned int randomState;
+} Tlb;
+
+// node of a page table; an inner node points to the nodes of the next
+//    level, a leaf holds the frame of each page ( -1 if unmapped )
+typedef struct PageNode
+{
+   struct PageNode **childArray;
+   int *frameArray;
+} PageNode;
+
+// one frame of memory and the page it holds, paged memory only
+typedef struct FrameEntry
+{
+   // process and page in the frame, null owner if the frame is free
+   struct PCB *ownerPcb;
+   int pageNumber;
+   
+   // page reference count when the page was loaded and when it was last
+   //    used, and the simulated time of that use
+   long long loadStamp;
+   long long useStamp;
+   int useMSec;
+   
+   // reference bit, set by each use and cleared by the clock hand
+   Boolean referenceFlag;
+} FrameEntry;
+
+// page references, and faults that had to evict a page, in one working
+//    set window of the run
+typedef struct FaultWindow
+{
+   int referenceCount;
+   int evictCount;
+} FaultWindow;
+
+// one simulated core of a multi-core run
+typedef struct SimCore
+{
+   // core number, shown in the log
+   int coreId;
+   
+   // run queue, ordered by the scheduler; round robin stamps PCBs from
+   //    the enqueue counter so the queue is first in first out
+   ReadyQueue readyQueue;
+   int readyCount;
+   int enqueueCounter;
+   
+   // IO completions of the blocked PCBs whose run queue is here
+   PcbHeap eventHeap;
+   
+   // running PCB and the start and end of its current op slice
+   PCB *runningPCB;
+   int sliceStart;
+   int sliceEnd;
+   
+   // pid of the last process selected, -1 before the first selection
+   int previousPid;
+   
+   // run summary
+   int busyMS;
+   int dispatchCount;
+   int stealCount;
+   
+   // overhead owed to the next dispatch, and whether the current slice
+   //    is the overhead of a dispatch rather than process time
+   int pendingOverheadMS;
+   Boolean overheadFlag;
+   
+   // overhead summary
+   int overheadMS;
+   int switchCount;
+   int interruptCount;
+   
+   // TLB of the core, paged memory only
+   Tlb tlb;
+} SimCore;
+
+// timing wheel slot layout; level zero has one slot per ms, each slot of
+//    the three upper levels spans a full turn of the level below it
+typedef enum { WHEEL_ZERO_SLOTS = 256,
+               WHEEL_LEVEL_SLOTS = 64,
+               WHEEL_OVERFLOW_SLOT = 448,
+               WHEEL_DUE_SLOT,
+               WHEEL_SLOT_COUNT } wheelSlotCodes;
+
+// hashed hierarchical timing wheel of blocked PCBs
+typedef struct TimingWheel
+{
+   // time the wheel has turned to, never past the simulated time
+   int wheelMSec;
+   
+   // PCB lists, one per slot, then the overflow and due lists
+   PCB *slotArray[ WHEEL_SLOT_COUNT ];
+   
+   // one bit per level slot that holds a PCB
+   unsigned long long slotBitmap[ WHEEL_OVERFLOW_SLOT / 64 ];
+} TimingWheel;
+
+// IO worker threads per simulation
+typedef enum { IO_WORKER_COUNT = 4 } ioPoolSizeCodes;
+
+// one IO op handed to the IO worker pool
+typedef struct IoRequest
+{
+   // process doing the IO
+   struct PCB *pcb;
+   
+   // absolute CLOCK_MONOTONIC time the device finishes the op
+   long long wakeNSec;
+   
+   // link in the completion stack or the free list
+   struct IoRequest *nextRequest;
+   
+   // link in the list of every request the pool allocated
+   struct IoRequest *nextAllocated;
+} IoRequest;
+
+// fixed pool of IO worker threads; the scheduler submits requests to a
+//    lock-free ring, the workers finish them in device finish time order
+//    and the scheduler waits on the completion stack before it wakes a
+//    process from IO
+typedef struct IoPool
+{
+   // worker threads, none until the pool is started
+   pthread_t workerArray[ IO_WORKER_COUNT ];
+   int workerCount;
+   
+   // bounded submission ring, each slot has a sequence number that
+   //    tells whether it is free for the next push or full for the next pop
+   IoRequest **ringArray;
+   unsigned long *sequenceArray;
+   unsigned long ringMask;
+   unsigned long enqueuePos;
+   unsigned long dequeuePos;
+   
+   // requests pushed and not yet popped, and workers asleep waiting
+   int queuedCount;
+   int idleCount;
+   
+   // popped requests not yet finished, a binary min heap on the device
+   //    finish time, held under the pool mutex
+   IoRequest **heapArray;
+   int heapSize;
+   int heapCapacity;
+   
+   // requests the workers have finished, pushed by any worker while it
+   //    holds the pool mutex
+   IoRequest *completionHead;
+   
+   // recycled requests and every allocated request, scheduler only
+   IoRequest *freeListHead;
+   IoRequest *allocatedHead;
+   
+   // wakeups for workers waiting on a request or the earliest finish
+   //    time, and for the scheduler waiting on a completion
+   Boolean stopFlag;
+   pthread_mutex_t poolMutex;
+   pthread_cond_t workCondition;
+   pthread_cond_t completionCondition;
+} IoPool;
+
+// orders of the buddy allocator, enough for the largest memory size
+typedef enum { BUDDY_ORDER_COUNT = 17 } buddyLimitCodes;
+
+// binary buddy free lists, built at the first buddy placement
+typedef struct BuddyLists
+{
+   // order of the free block starting at each address ( -1 if none ), the
+   //    lists linked through the addresses, and the head of each order's
+   //    list ( -1 if empty )
+   int *orderArray;
+   int *nextArray;
+   int *prevArray;
+   int headArray[ BUDDY_ORDER_COUNT ];
+} BuddyLists;
+
+// results of the allocations the MMU places, filled in as they run
+typedef struct PlacementReport
+{
+   // requests, and those that found no room
+   int requestCount;
+   int failCount;
+   
+   // free regions or buddy orders looked at per request
+   long long searchSum;
+   int searchMax;
+   
+   // external fragmentation in percent at each request ( share of the free
+   //    memory outside the largest free region )
+   double externalSum;
+   double externalMax;
+   
+   // memory asked for and memory handed out, the rest is internal
+   //    fragmentation
+   long long askedSum;
+   long long placedSum;
+   
+   // summary, set at the end
+   double failPercent;
+   double meanSearch;
+   double meanExternal;
+   double internalPercent;
+} PlacementReport;
+
+// results of the paged translations, summed over the processes at the end
+typedef struct PagingReport
+{
+   int hitCount;
+   int missCount;
+   int translationMS;
+   double hitPercent;
+   
+   // demand paging: pages loaded and pages evicted for them, the fault
+   //    share of the page references and the windows over the thrashing
+   //    rate
+   int faultCount;
+   int evictCount;
+   double faultPercent;
+   int thrashCount;
+   
+   // thrashing span a report line belongs to
+   int spanStartMSec;
+   int spanEndMSec;
+   double spanPercent;
+} PagingReport;
+
+// memory blocks in lower bound order, in an array that doubles when full
+typedef struct BlockArray
+{
+   struct MemoryBlock *blockArray;
+   int blockCount;
+   int blockCapacity;
+} BlockArray;
+
+// simulation context; owns all state of one simulation run so that
+//    several simulations can run at once in one process
+typedef struct SimContext
+{
+   // configuration data for this run
+   ConfigDataType *configPtr;
+   
+   // logging option for this run
+   int loggingFormatFlag;
+   
+   // head (empty line) and last node of the file output list
+   struct fileOutputBuffer *logListHead;
+   struct fileOutputBuffer *logListTail;
+   
+   // head of the PCB list
+   PCB *pcbListHead;
+   
+   // scheduler of the run, and its ready queue
+   const struct SchedulerOps *schedOps;
+   ReadyQueue readyQueue;
+   
+   // number of selections so far, stamps the selected PCB
+   int dispatchCounter;
+   
+   // simulated time charged so far, in ms
+   int simMSec;
+   
+   // blocked PCBs in IO completion order, in the heap or the wheel
+   PcbHeap eventHeap;
+   TimingWheel eventWheel;
+   
+   // running process and state counters
+   PCB *runningPCB;
+   int readyCount;
+   int blockedCount;
+   int exitCount;
+   
+   // PCBs at app end waiting to be set to EXIT
+   PCB *finishListHead;
+   
+   // pid of the last process selected, -1 before the first selection
+   int previousPid;
+   
+   // simulated cores of a multi-core run ( null for one core ), and the
+   //    core the logged event belongs to ( -1 for none )
+   SimCore *coreArray;
+   int coreCount;
+   int logCoreId;
+   
+   // parallel run worker this context is the shadow of ( null if none )
+   struct PdesWorker *pdesWorker;
+   
+   // time of the next MLFQ priority boost, -1 for none
+   int nextBoostMSec;
+   
+   // deadline results, shown at the end of the run
+   DeadlineReport deadlineReport;
+   
+   // context switch and interrupt overhead owed to the next dispatch,
+   //    and the overhead summary, summed over the cores at the end
+   int pendingOverheadMS;
+   int overheadMS;
+   int switchCount;
+   int interruptCount;
+   double overheadPercent;
+   
+   // device servers, used when the config limits the device channels,
+   //    and the device a report line belongs to
+   SimDevice deviceArray[ DEVICE_COUNT ];
+   int logDeviceId;
+   
+   // allocated memory blocks, and the free regions between them, both in
+   //    lower bound order
+   BlockArray memBlocks;
+   BlockArray freeRegions;
+   
+   // where the next fit search starts, the buddy free lists and the
+   //    placement results
+   int nextFitAddress;
+   BuddyLists buddyLists;
+   PlacementReport placementReport;
+   
+   // paged memory: free frames as a stack, the index bits of each page
+   //    table level, the TLB of the one cpu and the translation results
+   int *freeFrameArray;
+   int freeFrameCount;
+   int frameCount;
+   int pageLevelBits;
+   Tlb tlb;
+   PagingReport pagingReport;
+   
+   // demand paging: the page in each frame, the clock hand, the page
+   //    references so far and the references and faults of each window
+   FrameEntry *frameTable;
+   int clockHand;
+   long long referenceCounter;
+   FaultWindow *windowArray;
+   int windowCount;
+   int windowCapacity;
+   
+   // timer state and simulated clock
+   SimTimer timer;
+   
+   // suppresses all monitor output (batch runs)
+   Boolean quietFlag;
+   
+   // run summary
+   int processCount;
+   int segFaultCount;
+   int meanResponseMS;
+   int meanTurnaroundMS;
+   double endTime;
+   
+   // IO workers, real time only
+   IoPool ioPool;
+} SimContext;
+
+// data handed to a timer thread
+typedef struct TimerThreadData
+{
+   // timer of the simulation the thread belongs to
+   SimTimer *timer;
+   
+   // time to run
+   int milliseconds;
+} TimerThreadData;
+
 // function prototypes
-void runSim( ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr );
+void initSimContext( SimContext *simContext, ConfigDataType *configPtr,
+                                                               int timerMode );
+void clearSimContext( SimContext *simContext );
+void runSim( SimContext *simContext, OpCodeType *metaDataMstrPtr );
 void showProgramFormat();
 PCB *addPcbNode( PCB *localPtr, PCB *newNode );
 fileOutputBuffer *addListNode( fileOutputBuffer *localPtr, 
                                                    fileOutputBuffer *newNode );
-void *runThread( void *milliseconds );
+void *runThread( void *threadData );
 fileOutputBuffer *clearLogList( fileOutputBuffer *localPtr );
 PCB *clearPCBList( PCB *localPtr );
-void displayAndLog( int loggingFormatFlag, PCB *pcb, 
-         fileOutputBuffer *fileOutputHead, DisplayCodes arg1, DisplayCodes arg2 );
+void displayAndLog( SimContext *simContext, PCB *pcb, 
+                                       DisplayCodes arg1, DisplayCodes arg2 );
 DisplayCodes findDisplayCode( char *command );
 
 #endif   // SIMULATOR_H